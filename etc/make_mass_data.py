@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+# Generates src/MassData.h from etc/mass.txt (AME atomic masses). Run from the repository top level after updating mass.txt.
+import sys
+
+def main(input_path="etc/mass.txt", output_path="src/MassData.h"):
+    isotopes = {}
+    symbols = {}
+    with open(input_path) as massfile:
+        lines = massfile.read().split("\n")[2:]
+    for line in lines:
+        tokens = line.split()
+        if len(tokens) < 6:
+            continue
+        z, a = int(tokens[1]), int(tokens[2])
+        #repr of the parsed double round trips exactly, and avoids octal-looking literals from the zero padded AME columns
+        isotopes[(z, a)] = (repr(float(tokens[4])), repr(float(tokens[5])))
+        symbols[z] = tokens[3]
+
+    max_z = max(symbols)
+    first_index, min_a, n_a, entries = [], [], [], []
+    for z in range(max_z + 1):
+        a_values = [a for (zz, a) in isotopes if zz == z]
+        first_index.append(len(entries))
+        if not a_values:
+            min_a.append(0)
+            n_a.append(0)
+            continue
+        min_a.append(min(a_values))
+        n_a.append(max(a_values) - min(a_values) + 1)
+        for a in range(min(a_values), max(a_values) + 1):
+            entries.append(isotopes.get((z, a), ("0.0", "0.0")))
+
+    def rows(values, per_line):
+        return ",\n".join("\t\t\t" + ", ".join(values[i:i+per_line]) for i in range(0, len(values), per_line))
+
+    with open(output_path, "w") as out:
+        out.write("/*\nMassData.h\nAME atomic masses compiled into SabreRecon. Generated by etc/make_mass_data.py from etc/mass.txt -- do not edit by hand.\n")
+        out.write("Isotopes of each Z are stored contiguously by A starting at firstIndex[Z] (missing A hold zeros), so an isotope is found\n")
+        out.write("with a single index calculation. Masses are split as in the AME file: integer part (u) and remainder (micro-u).\n*/\n")
+        out.write("#ifndef MASS_DATA_H\n#define MASS_DATA_H\n\nnamespace SabreRecon {\n\n\tnamespace MassData {\n\n")
+        out.write("\t\tstruct AtomicMass\n\t\t{\n\t\t\tdouble u;\n\t\t\tdouble microU;\n\t\t};\n\n")
+        out.write("\t\tinline constexpr int maxZ = %d;\n" % max_z)
+        out.write("\t\tinline constexpr int nIsotopes = %d;\n\n" % len(entries))
+        out.write("\t\tinline constexpr const char* symbols[maxZ+1] =\n\t\t{\n%s\n\t\t};\n\n" % rows(['"%s"' % symbols.get(z, "") for z in range(max_z + 1)], 12))
+        out.write("\t\tinline constexpr int firstIndex[maxZ+1] =\n\t\t{\n%s\n\t\t};\n\n" % rows([str(v) for v in first_index], 12))
+        out.write("\t\tinline constexpr int minA[maxZ+1] =\n\t\t{\n%s\n\t\t};\n\n" % rows([str(v) for v in min_a], 12))
+        out.write("\t\tinline constexpr int nA[maxZ+1] =\n\t\t{\n%s\n\t\t};\n\n" % rows([str(v) for v in n_a], 12))
+        out.write("\t\tinline constexpr AtomicMass atomicMasses[nIsotopes] =\n\t\t{\n%s\n\t\t};\n\n" % rows(["{%s, %s}" % (u, micro) for (u, micro) in entries], 4))
+        out.write("\t}\n\n}\n\n#endif\n")
+
+if __name__ == "__main__":
+    main(*sys.argv[1:])
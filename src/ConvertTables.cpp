@@ -0,0 +1,45 @@
+#include "EnergyLoss/PunchTable.h"
+#include "EnergyLoss/ElossTable.h"
+#include <iostream>
+#include <string>
+
+/*
+	Converts text PunchTables/ElossTables into the binary (memory mapped) table format. The binary files can be given
+	to SabreRecon in place of the text files.
+	Usage: ConvertTables <punch|eloss> <input text table> <output binary table>
+*/
+int main(int argc, const char** argv)
+{
+	if(argc != 4)
+	{
+		std::cerr<<"Usage: ConvertTables <punch|eloss> <input text table> <output binary table>"<<std::endl;
+		return 1;
+	}
+
+	std::string type = argv[1];
+	bool success = false;
+	if(type == "punch")
+	{
+		PunchTable::PunchTable table(argv[2]);
+		success = table.IsValid() && table.WriteBinaryFile(argv[3]);
+	}
+	else if(type == "eloss")
+	{
+		PunchTable::ElossTable table(argv[2]);
+		success = table.IsValid() && table.WriteBinaryFile(argv[3]);
+	}
+	else
+	{
+		std::cerr<<"ERR -- Unrecognized table type "<<type<<"! Must be punch or eloss."<<std::endl;
+		return 1;
+	}
+
+	if(!success)
+	{
+		std::cerr<<"ERR -- Unable to convert table "<<argv[2]<<std::endl;
+		return 1;
+	}
+
+	std::cout<<"Converted "<<argv[2]<<" to binary table "<<argv[3]<<std::endl;
+	return 0;
+}
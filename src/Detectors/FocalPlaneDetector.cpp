@@ -12,17 +12,18 @@ namespace SabreRecon {
 
 	FocalPlaneDetector::~FocalPlaneDetector() {}
 
-	double FocalPlaneDetector::GetRho(double xavg)
+	//Calibration polynomial, evaluated with Horner's rule
+	double FocalPlaneDetector::GetRho(double xavg) const
 	{
 		double rho = 0.0;
-		for(size_t i=0; i< m_params.calParams.size(); i++)
+		for(size_t i=m_params.calParams.size(); i>0; i--)
 		{
-			rho += m_params.calParams[i]*std::pow(xavg, i);
+			rho = rho*xavg + m_params.calParams[i-1];
 		}
 		return rho;
 	}
 
-	double FocalPlaneDetector::GetP(double xavg, int Z)
+	double FocalPlaneDetector::GetP(double xavg, int Z) const
 	{
 		double rho = GetRho(xavg);
 		return Z*rho*m_params.B*s_qbrho2p;
@@ -21,8 +21,8 @@ namespace SabreRecon {
 		~FocalPlaneDetector();
 
 		void Init(const Parameters& params) { m_params = params; }
-		double GetRho(double xavg);
-		double GetP(double xavg, int Z);
+		double GetRho(double xavg) const;
+		double GetP(double xavg, int Z) const;
 		inline double GetFPTheta() const { return m_params.angle*s_deg2rad; }
 
 	private:
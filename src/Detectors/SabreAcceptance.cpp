@@ -0,0 +1,185 @@
+#include "SabreAcceptance.h"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+namespace SabreRecon {
+
+	SabreAcceptance::SabreAcceptance() :
+		m_nTheta(0), m_nPhi(0), m_thetaMin(0.0), m_thetaStep(0.0), m_invThetaStep(0.0), m_phiStep(0.0), m_invPhiStep(0.0), m_validFlag(false)
+	{
+	}
+
+	SabreAcceptance::SabreAcceptance(const std::vector<SabreDetector>& detectors, double thetaMin, double thetaMax, double thetaStep, double phiStep) :
+		SabreAcceptance()
+	{
+		Init(detectors, thetaMin, thetaMax, thetaStep, phiStep);
+	}
+
+	SabreAcceptance::~SabreAcceptance() {}
+
+	/*
+		Walk the grid one theta row at a time, keeping the flat coordinates of the row's lower and upper nodes and of the
+		cell centers for every detector, so each node is only calculated once.
+	*/
+	void SabreAcceptance::Init(const std::vector<SabreDetector>& detectors, double thetaMin, double thetaMax, double thetaStep, double phiStep)
+	{
+		m_validFlag = false;
+		m_cells.clear();
+		if(detectors.size()*s_channelsPerDetector > INT16_MAX || detectors.size() > std::size_t(INT16_MAX) + s_exactCode || thetaMax <= thetaMin || thetaStep <= 0.0 || phiStep <= 0.0)
+		{
+			std::cerr<<"WARN -- Invalid SabreAcceptance grid: "<<detectors.size()<<" detectors, theta ["<<thetaMin<<", "<<thetaMax<<"] step "<<thetaStep
+					 <<", phi step "<<phiStep<<std::endl;
+			return;
+		}
+
+		m_detectors = detectors;
+		m_nTheta = std::size_t(std::ceil((thetaMax - thetaMin)/thetaStep));
+		m_nPhi = std::size_t(std::ceil(2.0*M_PI/phiStep));
+		m_thetaMin = thetaMin;
+		m_thetaStep = (thetaMax - thetaMin)/m_nTheta;
+		m_invThetaStep = 1.0/m_thetaStep;
+		m_phiStep = 2.0*M_PI/m_nPhi;
+		m_invPhiStep = 1.0/m_phiStep;
+		m_cells.resize(m_nTheta*m_nPhi);
+
+		std::size_t nDetectors = m_detectors.size();
+		std::size_t nNodes = m_nPhi + 1;
+		//[detector][node] flat coordinates for the lower node row, upper node row, and cell centers
+		std::vector<double> lowerR(nDetectors*nNodes), lowerPhi(nDetectors*nNodes), upperR(nDetectors*nNodes), upperPhi(nDetectors*nNodes);
+		std::vector<double> centerR(nDetectors*m_nPhi), centerPhi(nDetectors*m_nPhi);
+		std::vector<char> lowerValid(nDetectors*nNodes), upperValid(nDetectors*nNodes), centerValid(nDetectors*m_nPhi);
+
+		auto fillRow = [this, nDetectors](double theta, double phiOffset, std::size_t count, double* r, double* phi, char* valid)
+		{
+			for(std::size_t d=0; d<nDetectors; d++)
+			{
+				for(std::size_t j=0; j<count; j++)
+				{
+					std::size_t index = d*count + j;
+					valid[index] = m_detectors[d].GetTrajectoryFlatCoordinates(theta, phiOffset + j*m_phiStep, r[index], phi[index])
+								   && std::isfinite(r[index]) && std::isfinite(phi[index]);
+					if(phi[index] > M_PI)
+						phi[index] -= 2.0*M_PI;
+				}
+			}
+		};
+
+		fillRow(m_thetaMin, 0.0, nNodes, upperR.data(), upperPhi.data(), upperValid.data());
+		double sampleR[s_nSamples], samplePhi[s_nSamples];
+		bool sampleValid[s_nSamples];
+		for(std::size_t i=0; i<m_nTheta; i++)
+		{
+			std::swap(lowerR, upperR);
+			std::swap(lowerPhi, upperPhi);
+			std::swap(lowerValid, upperValid);
+			fillRow(m_thetaMin + (i + 1)*m_thetaStep, 0.0, nNodes, upperR.data(), upperPhi.data(), upperValid.data());
+			fillRow(m_thetaMin + (i + 0.5)*m_thetaStep, 0.5*m_phiStep, m_nPhi, centerR.data(), centerPhi.data(), centerValid.data());
+
+			for(std::size_t j=0; j<m_nPhi; j++)
+			{
+				int16_t code = s_missCode;
+				for(std::size_t d=0; d<nDetectors; d++)
+				{
+					std::size_t nodes[2] = { d*nNodes + j, d*nNodes + j + 1 };
+					for(int k=0; k<2; k++)
+					{
+						sampleR[k] = lowerR[nodes[k]];
+						samplePhi[k] = lowerPhi[nodes[k]];
+						sampleValid[k] = lowerValid[nodes[k]];
+						sampleR[k+2] = upperR[nodes[k]];
+						samplePhi[k+2] = upperPhi[nodes[k]];
+						sampleValid[k+2] = upperValid[nodes[k]];
+					}
+					sampleR[4] = centerR[d*m_nPhi + j];
+					samplePhi[4] = centerPhi[d*m_nPhi + j];
+					sampleValid[4] = centerValid[d*m_nPhi + j];
+
+					int result = ClassifyCell(m_detectors[d], sampleR, samplePhi, sampleValid);
+					if(result == s_missCode)
+						continue;
+					else if(result == s_exactCode)
+						code = int16_t(s_exactCode - d);
+					else
+						code = int16_t(d*s_channelsPerDetector + result);
+					break;
+				}
+				m_cells[i*m_nPhi + j] = code;
+			}
+		}
+
+		m_validFlag = true;
+	}
+
+	/*
+		A detector's result is the same over the whole cell if the samples agree on the band, and each is further from a band
+		boundary than the samples spread. Agreeing on an outside/edge band in either coordinate is enough for a miss.
+	*/
+	int SabreAcceptance::ClassifyCell(const SabreDetector& detector, const double* r, const double* phi, const bool* valid) const
+	{
+		if(std::count(valid, valid + s_nSamples, true) != s_nSamples)
+		{
+			double r_flat, phi_flat;
+			//Detectors translated in x or y never report a hit; anything else is a degenerate cell
+			return detector.GetTrajectoryFlatCoordinates(0.0, 0.0, r_flat, phi_flat) ? s_exactCode : s_missCode;
+		}
+
+		double distance, rDistance, phiDistance;
+		int ringBand = detector.GetRingBand(r[0], rDistance);
+		int wedgeBand = detector.GetWedgeBand(phi[0], phiDistance);
+		double rMin = r[0], rMax = r[0], phiMin = phi[0], phiMax = phi[0];
+		bool ringConsistent = true, wedgeConsistent = true;
+		for(int k=1; k<s_nSamples; k++)
+		{
+			ringConsistent &= detector.GetRingBand(r[k], distance) == ringBand;
+			rDistance = std::min(rDistance, distance);
+			wedgeConsistent &= detector.GetWedgeBand(phi[k], distance) == wedgeBand;
+			phiDistance = std::min(phiDistance, distance);
+			rMin = std::min(rMin, r[k]);
+			rMax = std::max(rMax, r[k]);
+			phiMin = std::min(phiMin, phi[k]);
+			phiMax = std::max(phiMax, phi[k]);
+		}
+		ringConsistent &= rDistance > rMax - rMin;
+		wedgeConsistent &= phiDistance > phiMax - phiMin;
+
+		int ring = detector.GetRingFromBand(ringBand);
+		int wedge = detector.GetWedgeFromBand(wedgeBand);
+		if((ringConsistent && ring == -1) || (wedgeConsistent && wedge == -1))
+			return s_missCode;
+		else if(ringConsistent && wedgeConsistent)
+			return ring*s_nWedges + wedge;
+		return s_exactCode;
+	}
+
+	SabreChannel SabreAcceptance::FindChannelExact(double theta, double phi, std::size_t firstDetector) const
+	{
+		SabreChannel channel;
+		for(std::size_t d=firstDetector; d<m_detectors.size(); d++)
+		{
+			std::pair<int, int> ringWedge = m_detectors[d].GetTrajectoryRingWedge(theta, phi);
+			if(ringWedge.first != -1 && ringWedge.second != -1)
+			{
+				channel.detID = int(d);
+				channel.ring = ringWedge.first;
+				channel.wedge = ringWedge.second;
+				break;
+			}
+		}
+		return channel;
+	}
+
+	void SabreAcceptance::FindChannels(const double* theta, const double* phi, SabreChannel* channels, std::size_t n) const
+	{
+		for(std::size_t i=0; i<n; i++)
+			channels[i] = FindChannel(theta[i], phi[i]);
+	}
+
+	double SabreAcceptance::GetExactFraction() const
+	{
+		if(m_cells.empty())
+			return 0.0;
+		return double(std::count_if(m_cells.begin(), m_cells.end(), [](int16_t code) { return code < s_missCode; }))/m_cells.size();
+	}
+
+}
@@ -0,0 +1,96 @@
+/*
+SabreAcceptance.h
+Precomputed (theta, phi) lookup of which SABRE detector/ring/wedge a trajectory from the target hits, for the whole array.
+Each grid cell holds either a channel, a miss, or a flag that the cell straddles a strip edge or detector boundary, in which
+case the exact per-detector calculation (SabreDetector::GetTrajectoryRingWedge) is used. A cell is only given a channel
+or a miss when the flat coordinates at its corners and center all fall in the same band of every detector, with a margin
+larger than their spread across the cell.
+
+Rings are geometric (inner to outer); detector 4's reversed ring cabling is not applied. When more than one detector would
+claim a trajectory, the first in the array wins, as for the exact calculation.
+*/
+#ifndef SABRE_ACCEPTANCE_H
+#define SABRE_ACCEPTANCE_H
+
+#include "SabreDetector.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace SabreRecon {
+
+	struct SabreChannel
+	{
+		int detID = -1;
+		int ring = -1;
+		int wedge = -1;
+
+		inline bool IsHit() const { return detID != -1; }
+	};
+
+	class SabreAcceptance
+	{
+	public:
+		SabreAcceptance();
+		//Angles in radians. The grid spans [thetaMin, thetaMax] x [0, 2pi); trajectories outside use the exact calculation.
+		SabreAcceptance(const std::vector<SabreDetector>& detectors, double thetaMin, double thetaMax, double thetaStep, double phiStep);
+		~SabreAcceptance();
+
+		void Init(const std::vector<SabreDetector>& detectors, double thetaMin, double thetaMax, double thetaStep, double phiStep);
+		inline bool IsValid() const { return m_validFlag; }
+
+		inline SabreChannel FindChannel(double theta, double phi) const
+		{
+			double phiWrapped = phi < 0.0 ? phi + 2.0*M_PI : phi;
+			double thetaIndex = (theta - m_thetaMin)*m_invThetaStep;
+			double phiIndex = phiWrapped*m_invPhiStep;
+			if(!(thetaIndex >= 0.0 && thetaIndex < m_nTheta && phiIndex >= 0.0 && phiIndex < m_nPhi))
+				return FindChannelExact(theta, phi);
+
+			int16_t code = m_cells[std::size_t(thetaIndex)*m_nPhi + std::size_t(phiIndex)];
+			if(code == s_missCode)
+				return SabreChannel();
+			else if(code < s_missCode)
+				return FindChannelExact(theta, phi, s_missCode - code - 1);
+			return DecodeChannel(code);
+		}
+
+		//Batch version filling channels[i] for each (theta[i], phi[i])
+		void FindChannels(const double* theta, const double* phi, SabreChannel* channels, std::size_t n) const;
+		//Loops over the detectors from firstDetector on; what a cell flagged as a boundary falls back to
+		SabreChannel FindChannelExact(double theta, double phi, std::size_t firstDetector = 0) const;
+
+		//Fraction of cells that need the exact calculation
+		double GetExactFraction() const;
+
+	private:
+		//Band of one detector over a cell: a channel, a miss, or ambiguous
+		int ClassifyCell(const SabreDetector& detector, const double* r, const double* phi, const bool* valid) const;
+
+		inline SabreChannel DecodeChannel(int16_t code) const
+		{
+			SabreChannel channel;
+			channel.detID = code/s_channelsPerDetector;
+			channel.ring = (code % s_channelsPerDetector)/s_nWedges;
+			channel.wedge = code % s_nWedges;
+			return channel;
+		}
+
+		std::vector<SabreDetector> m_detectors;
+		std::vector<int16_t> m_cells; //theta major; a channel, a miss, or the first detector needing the exact calculation
+		std::size_t m_nTheta, m_nPhi;
+		double m_thetaMin, m_thetaStep, m_invThetaStep;
+		double m_phiStep, m_invPhiStep;
+
+		bool m_validFlag;
+
+		static constexpr int16_t s_missCode = -1;
+		static constexpr int16_t s_exactCode = -2; //for detector 0; detector d is s_exactCode - d
+		static constexpr int s_nWedges = 8;
+		static constexpr int s_channelsPerDetector = 16*s_nWedges;
+		static constexpr int s_nSamples = 5; //four corners and the center of a cell
+	};
+
+}
+
+#endif
@@ -55,7 +55,7 @@
 
 namespace SabreRecon {
 
-	void PrintMatrix(TRotation& mat)
+	void PrintMatrix(const Rotation& mat)
 	{
 		std::cout<<"XX: "<<mat.XX()<<" XY: "<<mat.XY()<<" XZ: "<<mat.XZ()<<std::endl;
 		std::cout<<"YX: "<<mat.YX()<<" YY: "<<mat.YY()<<" YZ: "<<mat.YZ()<<std::endl;
@@ -63,11 +63,15 @@ namespace SabreRecon {
 	}
 
 	SabreDetector::SabreDetector() :
-		m_phiCentral(0.0), m_tilt(0.0), m_translation(0.,0.,0.), m_norm_flat(0,0,1.0), m_drawingFlag(true), m_channelSmear(0.0, 1.0),
+		m_phiCentral(0.0), m_tilt(0.0), m_translation(0.,0.,0.), m_norm_flat(0,0,1.0), m_drawingFlag(true),
 		m_detectorID(-1)
 	{
 		m_YRot.RotateY(-1.0*m_tilt);
 		m_ZRot.RotateZ(m_phiCentral);
+		m_sinPhiCentral = std::sin(m_phiCentral);
+		m_cosPhiCentral = std::cos(m_phiCentral);
+		m_sinTilt = std::sin(m_tilt);
+		m_cosTilt = std::cos(m_tilt);
 	
 		//Initialize the coordinate arrays
 		m_ringCoords_flat.resize(s_nRings);
@@ -87,16 +91,22 @@ namespace SabreRecon {
 	
 		m_deltaR_flat = s_Router - s_Rinner;
 		m_deltaR_flat_ring = m_deltaR_flat/s_nRings;
+		m_deltaPhi_flat_wedge = s_deltaPhi_flat/s_nWedges;
 	
 		CalculateCorners();
+		CalculatePixels();
 	}
 	
 	SabreDetector::SabreDetector(const Parameters& params) :
 		m_phiCentral(params.phiCenter), m_tilt(params.tilt), m_translation(0., 0., params.zOffset), m_norm_flat(0,0,1.0), 
-		m_drawingFlag(params.drawing), m_channelSmear(0.0, 1.0), m_detectorID(params.detID)
+		m_drawingFlag(params.drawing), m_detectorID(params.detID)
 	{
 		m_YRot.RotateY(-1.0*m_tilt); //clockwise rotation
 		m_ZRot.RotateZ(m_phiCentral);
+		m_sinPhiCentral = std::sin(m_phiCentral);
+		m_cosPhiCentral = std::cos(m_phiCentral);
+		m_sinTilt = std::sin(m_tilt);
+		m_cosTilt = std::cos(m_tilt);
 
 		m_deltaR_flat = s_Router - s_Rinner;
 		m_deltaR_flat_ring = m_deltaR_flat/s_nRings;
@@ -122,6 +132,8 @@ namespace SabreRecon {
 
 			CalculateCorners();
 		}
+
+		CalculatePixels();
 	}
 	
 	SabreDetector::~SabreDetector() {}
@@ -195,6 +207,42 @@ namespace SabreRecon {
 		}
 	}
 
+	/*
+		Cache the geometry of every pixel center, along with the tilted normal and in-plane axes, so that hits
+		don't have to go through the rotations.
+	*/
+	void SabreDetector::CalculatePixels()
+	{
+		m_xAxisTilted = m_ZRot*(m_YRot*Vec3(1.0, 0.0, 0.0));
+		m_yAxisTilted = m_ZRot*(m_YRot*Vec3(0.0, 1.0, 0.0));
+		m_normTilted = m_ZRot*(m_YRot*m_norm_flat);
+
+		m_pixels.resize(s_nRings*s_nWedges);
+		for(int i=0; i<s_nRings; i++)
+		{
+			for(int j=0; j<s_nWedges; j++)
+			{
+				Pixel& pixel = m_pixels[i*s_nWedges + j];
+				pixel.detID = m_detectorID;
+				pixel.index = i*s_nWedges + j;
+				double phiFlat = -s_deltaPhi_flat/2.0 + (j + 0.5)*m_deltaPhi_flat_wedge;
+				pixel.rFlat = s_Rinner + (i + 0.5)*m_deltaR_flat_ring;
+				pixel.cosPhiFlat = std::cos(phiFlat);
+				pixel.sinPhiFlat = std::sin(phiFlat);
+
+				Vec3 center(pixel.rFlat*pixel.cosPhiFlat, pixel.rFlat*pixel.sinPhiFlat, 0.0);
+				pixel.centroid = TransformToTiltedFrame(center);
+				pixel.theta = pixel.centroid.Theta();
+				pixel.phi = pixel.centroid.Phi();
+				pixel.sinTheta = std::sin(pixel.theta);
+				pixel.cosTheta = std::cos(pixel.theta);
+				pixel.sinPhi = std::sin(pixel.phi);
+				pixel.cosPhi = std::cos(pixel.phi);
+				pixel.incidentAngle = GetIncidentAngle(pixel.centroid);
+			}
+		}
+	}
+
 	/*
 		Given a unit vector (R=1, theta, phi) which corresponds to some particle's trajectory,
 		determine whether that particle will intersect with this SABRE detector. If it does calculate
@@ -212,34 +260,38 @@ namespace SabreRecon {
 		!NOTE: This currently only applies to a configuration where there is no translation in x & y. The math becomes significantly messier in these cases.
 		Also, don't use tan(). It's behavior near PI/2 makes it basically useless for these.
 	*/
-	TVector3 SabreDetector::GetTrajectoryCoordinates(double theta, double phi)
+	Vec3 SabreDetector::GetTrajectoryCoordinates(double theta, double phi) const
 	{
 		if(m_translation.X() != 0.0 || m_translation.Y() != 0.0)
-			return TVector3();
+			return Vec3();
+
+		double sinTheta = std::sin(theta), cosTheta = std::cos(theta);
+		double sinPhi = std::sin(phi), cosPhi = std::cos(phi);
 	
 		//Calculate the *potential* phi in the flat detector
-		double phi_numerator = std::cos(m_tilt)*(std::sin(phi)*std::cos(m_phiCentral) - std::sin(m_phiCentral)*std::cos(phi));
-		double phi_denominator = std::cos(m_phiCentral)*std::cos(phi) + std::sin(m_phiCentral)*std::sin(phi);
+		double phi_numerator = m_cosTilt*(sinPhi*m_cosPhiCentral - m_sinPhiCentral*cosPhi);
+		double phi_denominator = m_cosPhiCentral*cosPhi + m_sinPhiCentral*sinPhi;
 		double phi_flat = std::atan2(phi_numerator, phi_denominator);
 		if(phi_flat < 0) phi_flat += M_PI*2.0;
+		double cosPhiFlat = std::cos(phi_flat), sinPhiFlat = std::sin(phi_flat);
 	
 		//Calculate the *potential* R in the flat detector
-		double r_numerator = m_translation.Z()*std::cos(phi)*std::sin(theta);
-		double r_denominator = std::cos(phi_flat)*std::cos(m_phiCentral)*std::cos(m_tilt)*std::cos(theta) - std::sin(phi_flat)*std::sin(m_phiCentral)*std::cos(theta) - std::cos(phi_flat)*std::sin(m_tilt)*std::cos(phi)*std::sin(theta);
+		double r_numerator = m_translation.Z()*cosPhi*sinTheta;
+		double r_denominator = cosPhiFlat*m_cosPhiCentral*m_cosTilt*cosTheta - sinPhiFlat*m_sinPhiCentral*cosTheta - cosPhiFlat*m_sinTilt*cosPhi*sinTheta;
 		double r_flat = r_numerator/r_denominator;
 	
 		//Calculate the distance from the origin to the hit on the detector
-		double R_to_detector = (r_flat*std::cos(phi_flat)*std::sin(m_tilt) + m_translation.Z())/std::cos(theta);
-		double xhit = R_to_detector*std::sin(theta)*std::cos(phi);
-		double yhit = R_to_detector*std::sin(theta)*std::sin(phi);
-		double zhit = R_to_detector*std::cos(theta);
+		double R_to_detector = (r_flat*cosPhiFlat*m_sinTilt + m_translation.Z())/cosTheta;
+		double xhit = R_to_detector*sinTheta*cosPhi;
+		double yhit = R_to_detector*sinTheta*sinPhi;
+		double zhit = R_to_detector*cosTheta;
 	
 	
 		//Check to see if our flat coords fall inside the flat detector
 		if(IsInside(r_flat, phi_flat))
-			return TVector3(xhit, yhit, zhit);
+			return Vec3(xhit, yhit, zhit);
 		else
-			return TVector3();
+			return Vec3();
 	}
 	
 	/*
@@ -253,92 +305,90 @@ namespace SabreRecon {
 		and Tilted_vector is the vector of the hit coordinates in the tilted frame. The theta and phi of the the Tilted_vector correspond
 		to the input arguments of the function.
 	
-		Then using the flat coordinate R' and phi' determine which ring/wedge channels are hit. For precision purposes, the channel is not calculated, but
-		rather found using comparisions. This method accounts for the spacing between rings and wedges.
+		Then using the flat coordinate R' and phi' determine which ring/wedge channels are hit. The channel is indexed directly from R' and phi',
+		and only the nearest strip edge is compared against the tolerance. This method accounts for the spacing between rings and wedges.
 	
 		!NOTE: This currently only applies to a configuration where there is no translation in x & y. The math becomes significantly messier in these cases.
 		Also, don't use tan(). It's behavior near PI/2 makes it basically useless for these.
 	*/
-	std::pair<int, int> SabreDetector::GetTrajectoryRingWedge(double theta, double phi)
+	std::pair<int, int> SabreDetector::GetTrajectoryRingWedge(double theta, double phi) const
 	{
-		phi = phi < 0 ? 2.0*M_PI + phi : phi;
-		if(m_translation.X() != 0.0 || m_translation.Y() != 0.0)
+		double r_flat, phi_flat;
+		if(!GetTrajectoryFlatCoordinates(theta, phi, r_flat, phi_flat))
 			return std::make_pair(-1, -1);
 	
-		//Calculate the *potential* phi in the flat detector
-		double phi_numerator = std::cos(m_tilt)*(std::sin(phi)*std::cos(m_phiCentral) - std::sin(m_phiCentral)*std::cos(phi));
-		double phi_denominator = std::cos(m_phiCentral)*std::cos(phi) + std::sin(m_phiCentral)*std::sin(phi);
-		double phi_flat = std::atan2(phi_numerator, phi_denominator);
-		if(phi_flat < 0) phi_flat += M_PI*2.0;
-	
-		//Calculate the *potential* R in the flat detector
-		double r_numerator = m_translation.Z()*std::cos(phi)*std::sin(theta);
-		double r_denominator = std::cos(phi_flat)*std::cos(m_phiCentral)*std::cos(m_tilt)*std::cos(theta) - std::sin(phi_flat)*std::sin(m_phiCentral)*std::cos(theta) - std::cos(phi_flat)*std::sin(m_tilt)*std::cos(phi)*std::sin(theta);
-		double r_flat = r_numerator/r_denominator;
-	
-		//Calculate the distance from the origin to the hit on the detector
-		//double R_to_detector = (r_flat*std::cos(phi_flat)*std::sin(m_tilt) + m_translation.GetZ())/std::cos(theta);
-	
 		//Check to see if our flat coords fall inside the flat detector
 		if(IsInside(r_flat, phi_flat))
 		{
-			int ringch, wedgech;
 			if(phi_flat > M_PI) phi_flat -= 2.0*M_PI; //Need phi in terms of [-deltaPhi_flat/2, deltaPhi_flat/2]
-			for(int i=0; i<s_nRings; i++) {
-				if(IsRingTopEdge(r_flat, i) || IsRingBottomEdge(r_flat, i))
-				{ //If it falls in the interstrip spacing, kill it
-					ringch = -1;
-					break;
-				}
-				else if(IsRing(r_flat, i))
-				{
-					ringch = i;
-					break;
-				}
-			}
-			for(int i=0; i<s_nWedges; i++)
-			{
-				if(IsWedgeTopEdge(phi_flat, i) || IsWedgeBottomEdge(phi_flat, i))
-				{ //If it falls in the interstrip spacing, kill it
-					wedgech = -1;
-					break;
-				}
-				else if(IsWedge(phi_flat, i))
-				{
-					wedgech = i;
-					break;
-				}
-			}
-			return std::make_pair(ringch, wedgech);
+			return std::make_pair(FindRing(r_flat), FindWedge(phi_flat));
 		}
 		else
 		{
 			return std::make_pair(-1,-1);
 		}
 	}
+
+	/*Flat frame R' and phi' (phi' in [0, 2pi)) of a trajectory, as described above. False if the detector is translated in x or y.*/
+	bool SabreDetector::GetTrajectoryFlatCoordinates(double theta, double phi, double& r_flat, double& phi_flat) const
+	{
+		phi = phi < 0 ? 2.0*M_PI + phi : phi;
+		if(m_translation.X() != 0.0 || m_translation.Y() != 0.0)
+			return false;
+
+		double sinTheta = std::sin(theta), cosTheta = std::cos(theta);
+		double sinPhi = std::sin(phi), cosPhi = std::cos(phi);
+	
+		//Calculate the *potential* phi in the flat detector. Its sin/cos follow from the atan2 arguments.
+		double phi_numerator = m_cosTilt*(sinPhi*m_cosPhiCentral - m_sinPhiCentral*cosPhi);
+		double phi_denominator = m_cosPhiCentral*cosPhi + m_sinPhiCentral*sinPhi;
+		phi_flat = std::atan2(phi_numerator, phi_denominator);
+		if(phi_flat < 0) phi_flat += M_PI*2.0;
+		double phi_norm = std::sqrt(phi_numerator*phi_numerator + phi_denominator*phi_denominator);
+		double cosPhiFlat = phi_denominator/phi_norm, sinPhiFlat = phi_numerator/phi_norm;
+	
+		//Calculate the *potential* R in the flat detector
+		double r_numerator = m_translation.Z()*cosPhi*sinTheta;
+		double r_denominator = cosPhiFlat*m_cosPhiCentral*m_cosTilt*cosTheta - sinPhiFlat*m_sinPhiCentral*cosTheta - cosPhiFlat*m_sinTilt*cosPhi*sinTheta;
+		r_flat = r_numerator/r_denominator;
+		return true;
+	}
+
+	void SabreDetector::GetTrajectoryRingWedge(const double* theta, const double* phi, int* rings, int* wedges, std::size_t n) const
+	{
+		for(std::size_t i=0; i<n; i++)
+		{
+			std::pair<int, int> channels = GetTrajectoryRingWedge(theta[i], phi[i]);
+			rings[i] = channels.first;
+			wedges[i] = channels.second;
+		}
+	}
 	
 	/*
 		Given a ring/wedge of this SABRE detector, calculate the coordinates of a hit.
-		Currently gives a point in the *center* of the pixel. Better method would be to
-		randomly wiggle the point within the pixel. Method intended for use with data, or
+		The point is randomly wiggled within the pixel (uniform in r and phi). Method intended for use with data, or
 		to smear out simulated data to mimic real data.
+
+		The wiggle is applied as an offset from the cached pixel center in the flat frame (only the small phi offset needs a
+		sin/cos), and the result is placed with the cached tilted axes instead of the rotations.
 	*/
-	TVector3 SabreDetector::GetHitCoordinates(int ringch, int wedgech)
+	Vec3 SabreDetector::GetHitCoordinates(int ringch, int wedgech) const
 	{
 		if(!CheckRingChannel(ringch) || !CheckWedgeChannel(wedgech))
-			return TVector3();
+			return Vec3();
 
+		const Pixel& pixel = m_pixels[ringch*s_nWedges + wedgech];
 		RandomGenerator& gen = RandomGenerator::GetInstance();
-		double ringSmear = m_channelSmear(gen.GetGenerator());
-		double wedgeSmear = m_channelSmear(gen.GetGenerator());
-		double r_center  = s_Rinner + (ringch + ringSmear)*m_deltaR_flat_ring;
-		double phi_center = -s_deltaPhi_flat/2.0 + (wedgech + wedgeSmear)*m_deltaPhi_flat_wedge;
-		double x = r_center*std::cos(phi_center);
-		double y = r_center*std::sin(phi_center);
-		double z = 0;
-	
-		TVector3 hit(x, y, z);
-		return TransformToTiltedFrame(hit);
+		double ringSmear = gen.Uniform();
+		double wedgeSmear = gen.Uniform();
+		double r_hit = pixel.rFlat + (ringSmear - 0.5)*m_deltaR_flat_ring;
+		double phi_offset = (wedgeSmear - 0.5)*m_deltaPhi_flat_wedge;
+		double cos_offset = std::cos(phi_offset);
+		double sin_offset = std::sin(phi_offset);
+		double x = r_hit*(pixel.cosPhiFlat*cos_offset - pixel.sinPhiFlat*sin_offset);
+		double y = r_hit*(pixel.sinPhiFlat*cos_offset + pixel.cosPhiFlat*sin_offset);
+
+		return x*m_xAxisTilted + y*m_yAxisTilted + m_translation;
 	}
 
 }
\ No newline at end of file
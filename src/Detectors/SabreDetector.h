@@ -53,10 +53,12 @@
 #define SABREDETECTOR_H
 
 #include <vector>
+#include <utility>
+#include <cstddef>
 #include <cmath>
 
-#include "TVector3.h"
-#include "TRotation.h"
+#include "Kinematics/Vec3.h"
+#include "Kinematics/Rotation.h"
 
 #include "RandomGenerator.h"
 
@@ -78,24 +80,87 @@ namespace SabreRecon {
 			int detID=-1;
 		};
 	
+		/*
+			Cached geometry of one ring/wedge pixel, evaluated at the pixel center. Angles are of the center as seen
+			from the target; the incident angle is taken against the detector normal and folded into [0, pi/2].
+		*/
+		struct Pixel
+		{
+			Vec3 centroid;
+			double theta=0.0, phi=0.0;
+			double sinTheta=0.0, cosTheta=0.0, sinPhi=0.0, cosPhi=0.0;
+			double incidentAngle=0.0;
+			double rFlat=0.0, cosPhiFlat=1.0, sinPhiFlat=0.0; //pixel center in the flat detector frame
+			int detID=-1, index=-1; //index is ring major within the detector; -1 for an invalid channel
+		};
+
 		SabreDetector();
 		SabreDetector(const Parameters& params);
 		~SabreDetector();
 
 		/*Return coordinates of the corners of each ring/wedge in SABRE*/
-		inline TVector3 GetRingFlatCoords(int ch, int corner) { return m_drawingFlag && CheckRingLocation(ch, corner) ? m_ringCoords_flat[ch][corner] : TVector3(); }
-		inline TVector3 GetWedgeFlatCoords(int ch, int corner) { return m_drawingFlag && CheckWedgeLocation(ch, corner) ? m_wedgeCoords_flat[ch][corner] : TVector3(); }
-		inline TVector3 GetRingTiltCoords(int ch, int corner) { return m_drawingFlag && CheckRingLocation(ch, corner) ? m_ringCoords_tilt[ch][corner] : TVector3(); }
-		inline TVector3 GetWedgeTiltCoords(int ch, int corner) { return m_drawingFlag && CheckWedgeLocation(ch, corner) ? m_wedgeCoords_tilt[ch][corner] : TVector3(); }
+		inline Vec3 GetRingFlatCoords(int ch, int corner) { return m_drawingFlag && CheckRingLocation(ch, corner) ? m_ringCoords_flat[ch][corner] : Vec3(); }
+		inline Vec3 GetWedgeFlatCoords(int ch, int corner) { return m_drawingFlag && CheckWedgeLocation(ch, corner) ? m_wedgeCoords_flat[ch][corner] : Vec3(); }
+		inline Vec3 GetRingTiltCoords(int ch, int corner) { return m_drawingFlag && CheckRingLocation(ch, corner) ? m_ringCoords_tilt[ch][corner] : Vec3(); }
+		inline Vec3 GetWedgeTiltCoords(int ch, int corner) { return m_drawingFlag && CheckWedgeLocation(ch, corner) ? m_wedgeCoords_tilt[ch][corner] : Vec3(); }
 	
-		TVector3 GetTrajectoryCoordinates(double theta, double phi);
-		std::pair<int, int> GetTrajectoryRingWedge(double theta, double phi);
-		TVector3 GetHitCoordinates(int ringch, int wedgech);
+		Vec3 GetTrajectoryCoordinates(double theta, double phi) const;
+		std::pair<int, int> GetTrajectoryRingWedge(double theta, double phi) const;
+		//Batch version filling rings[i], wedges[i] for each (theta[i], phi[i]); -1 for a miss as above
+		void GetTrajectoryRingWedge(const double* theta, const double* phi, int* rings, int* wedges, std::size_t n) const;
+		bool GetTrajectoryFlatCoordinates(double theta, double phi, double& r_flat, double& phi_flat) const;
+		Vec3 GetHitCoordinates(int ringch, int wedgech) const;
+
+		/*
+			The strip edges, widened by the tolerances, split the flat R' axis (and phi' in [-pi, pi]) into bands: band 2k+1 is
+			edge k, and the even bands between edges are either a channel or outside of the detector. distance is how far the
+			coordinate is from the nearest band boundary. Used to classify whole regions of trajectories at once.
+		*/
+		inline int GetRingBand(double r, double& distance) const
+		{
+			int edge = int(std::floor((r - s_Rinner)/m_deltaR_flat_ring + 0.5));
+			edge = edge < 0 ? 0 : (edge > s_nRings ? s_nRings : edge);
+			double offset = r - (s_Rinner + m_deltaR_flat_ring*edge);
+			distance = std::fabs(std::fabs(offset) - position_tol);
+			if(CheckPositionEqual(r, s_Rinner + m_deltaR_flat_ring*edge))
+				return 2*edge + 1;
+			return offset < 0.0 ? 2*edge : 2*edge + 2;
+		}
+
+		inline int GetWedgeBand(double phi, double& distance) const
+		{
+			int edge = int(std::floor((phi + s_deltaPhi_flat/2.0)/m_deltaPhi_flat_wedge + 0.5));
+			edge = edge < 0 ? 0 : (edge > s_nWedges ? s_nWedges : edge);
+			double offset = phi - (-s_deltaPhi_flat/2.0 + m_deltaPhi_flat_wedge*edge);
+			distance = std::fabs(std::fabs(offset) - angular_tol);
+			if(CheckAngleEqual(phi, -s_deltaPhi_flat/2.0 + m_deltaPhi_flat_wedge*edge))
+				return 2*edge + 1;
+			return offset < 0.0 ? 2*edge : 2*edge + 2;
+		}
+
+		//-1 for edges and outside of the detector
+		inline int GetRingFromBand(int band) const { return band%2 == 0 && band >= 2 && band <= 2*s_nRings ? band/2 - 1 : -1; }
+		inline int GetWedgeFromBand(int band) const { return band%2 == 0 && band >= 2 && band <= 2*s_nWedges ? band/2 - 1 : -1; }
+		//Returns a default (zero) pixel for an invalid channel
+		inline const Pixel& GetPixel(int ringch, int wedgech) const
+		{
+			static const Pixel invalid;
+			return CheckRingChannel(ringch) && CheckWedgeChannel(wedgech) ? m_pixels[ringch*s_nWedges + wedgech] : invalid;
+		}
+		//By Pixel::index
+		inline const Pixel& GetPixel(int index) const { return m_pixels[index]; }
 
 		inline const int GetDetectorID() const { return m_detectorID; }
+		static constexpr int GetNumberOfPixels() { return s_nRings*s_nWedges; }
 	
 		/*Basic getters*/
-		inline TVector3 GetNormTilted() { return m_ZRot * m_YRot * m_norm_flat; }
+		inline const Vec3& GetNormTilted() const { return m_normTilted; }
+		//Angle between a trajectory (any length) and the detector normal, folded into [0, pi/2] as Pixel::incidentAngle
+		inline double GetIncidentAngle(const Vec3& direction) const
+		{
+			double angle = std::acos(m_normTilted.Dot(direction)/(m_normTilted.Mag()*direction.Mag()));
+			return angle > M_PI/2.0 ? M_PI - angle : angle;
+		}
 	
 	
 	private:
@@ -112,26 +177,27 @@ namespace SabreRecon {
 		static constexpr double angular_tol = 0.1*M_PI/180.0; // 0.1 degree angular tolerance
 	
 		void CalculateCorners();
+		void CalculatePixels();
 	
 		/*Performs the transformation to the tilted,rotated,translated frame of the SABRE detector*/
-		inline TVector3 TransformToTiltedFrame(TVector3& vector) { return (vector.Transform(m_YRot)).Transform(m_ZRot) + m_translation; }
+		inline Vec3 TransformToTiltedFrame(const Vec3& vector) const { return m_ZRot*(m_YRot*vector) + m_translation; }
 	
 		/*Determine if a given channel/corner combo is valid*/
-		inline bool CheckRingChannel(int ch) { return (ch<s_nRings && ch>=0) ? true : false; }
-		inline bool CheckWedgeChannel(int ch) { return (ch<s_nWedges && ch >=0) ? true : false; }
-		inline bool CheckCorner(int corner) { return (corner < 4 && corner >=0) ? true : false; }
-		inline bool CheckRingLocation(int ch, int corner) { return CheckRingChannel(ch) && CheckCorner(corner); }
-		inline bool CheckWedgeLocation(int ch, int corner) { return CheckWedgeChannel(ch) && CheckCorner(corner); }
+		inline bool CheckRingChannel(int ch) const { return (ch<s_nRings && ch>=0) ? true : false; }
+		inline bool CheckWedgeChannel(int ch) const { return (ch<s_nWedges && ch >=0) ? true : false; }
+		inline bool CheckCorner(int corner) const { return (corner < 4 && corner >=0) ? true : false; }
+		inline bool CheckRingLocation(int ch, int corner) const { return CheckRingChannel(ch) && CheckCorner(corner); }
+		inline bool CheckWedgeLocation(int ch, int corner) const { return CheckWedgeChannel(ch) && CheckCorner(corner); }
 	
 		/*
 			For all of the calculations, need a limit precision to determine if values are actually equal or not
 			Here the approx. size of the strip spacing is used as the precision.
 		*/
-		inline bool CheckPositionEqual(double val1,double val2) { return fabs(val1-val2) > position_tol ? false : true; }
-		inline bool CheckAngleEqual(double val1,double val2) { return fabs(val1-val2) > angular_tol ? false : true; }
+		inline bool CheckPositionEqual(double val1,double val2) const { return fabs(val1-val2) > position_tol ? false : true; }
+		inline bool CheckAngleEqual(double val1,double val2) const { return fabs(val1-val2) > angular_tol ? false : true; }
 	
 		/*Determine if a hit is within the bulk detector*/
-		inline bool IsInside(double r, double phi)
+		inline bool IsInside(double r, double phi) const
 		{ 
 			double phi_1 = s_deltaPhi_flat/2.0;
 			double phi_2 = M_PI*2.0 - s_deltaPhi_flat/2.0;
@@ -143,59 +209,87 @@ namespace SabreRecon {
 			For a given radius/phi are you inside of a given ring/wedge channel,
 			or are you on the spacing between these channels
 		*/
-		inline bool IsRing(double r, int ringch)
+		inline bool IsRing(double r, int ringch) const
 		{
 			double ringtop = s_Rinner + m_deltaR_flat_ring*(ringch + 1);
 			double ringbottom = s_Rinner + m_deltaR_flat_ring*(ringch);
 			return (r>ringbottom && r<ringtop); 
 		}
 	
-		inline bool IsRingTopEdge(double r, int ringch)
+		inline bool IsRingTopEdge(double r, int ringch) const
 		{
 			double ringtop = s_Rinner + m_deltaR_flat_ring*(ringch + 1);
 			return CheckPositionEqual(r, ringtop); 
 		}
 	
-		inline bool IsRingBottomEdge(double r, int ringch)
+		inline bool IsRingBottomEdge(double r, int ringch) const
 		{
 			double ringbottom = s_Rinner + m_deltaR_flat_ring*(ringch);
 			return CheckPositionEqual(r, ringbottom); 
 		}
 	
-		inline bool IsWedge(double phi, int wedgech)
+		inline bool IsWedge(double phi, int wedgech) const
 		{
 			double wedgetop = -s_deltaPhi_flat/2.0 + m_deltaPhi_flat_wedge*(wedgech+1);
 			double wedgebottom = -s_deltaPhi_flat/2.0 + m_deltaPhi_flat_wedge*(wedgech);
 			return ((phi>wedgebottom && phi<wedgetop));
 		}
 	
-		inline bool IsWedgeTopEdge(double phi, int wedgech)
+		inline bool IsWedgeTopEdge(double phi, int wedgech) const
 		{
 			double wedgetop = -s_deltaPhi_flat/2.0 + m_deltaPhi_flat_wedge*(wedgech+1);
 			return CheckAngleEqual(phi, wedgetop);
 		}
 	
-		inline bool IsWedgeBottomEdge(double phi, int wedgech)
+		inline bool IsWedgeBottomEdge(double phi, int wedgech) const
 		{
 			double wedgebottom = -s_deltaPhi_flat/2.0 + m_deltaPhi_flat_wedge*(wedgech);
 			return CheckAngleEqual(phi, wedgebottom);
 		}
 
+		/*
+			Direct index versions of the loops over IsRing/IsWedge and their edges: the channel is found from the
+			position, and only the nearest edge is checked against the tolerance. -1 if it falls in the interstrip spacing.
+			The edges are computed with the same expressions as above, so the results are identical.
+		*/
+		inline int FindRing(double r) const
+		{
+			int edge = int(std::floor((r - s_Rinner)/m_deltaR_flat_ring + 0.5));
+			edge = edge < 0 ? 0 : (edge > s_nRings ? s_nRings : edge);
+			if(CheckPositionEqual(r, s_Rinner + m_deltaR_flat_ring*edge))
+				return -1;
+			int ringch = int(std::floor((r - s_Rinner)/m_deltaR_flat_ring));
+			return CheckRingChannel(ringch) ? ringch : -1;
+		}
+
+		inline int FindWedge(double phi) const
+		{
+			int edge = int(std::floor((phi + s_deltaPhi_flat/2.0)/m_deltaPhi_flat_wedge + 0.5));
+			edge = edge < 0 ? 0 : (edge > s_nWedges ? s_nWedges : edge);
+			if(CheckAngleEqual(phi, -s_deltaPhi_flat/2.0 + m_deltaPhi_flat_wedge*edge))
+				return -1;
+			int wedgech = int(std::floor((phi + s_deltaPhi_flat/2.0)/m_deltaPhi_flat_wedge));
+			return CheckWedgeChannel(wedgech) ? wedgech : -1;
+		}
+
 
 		/*Class data*/
 		double m_phiCentral, m_tilt;
-		TVector3 m_translation;
-		TRotation m_YRot;
-		TRotation m_ZRot;
+		double m_sinPhiCentral, m_cosPhiCentral, m_sinTilt, m_cosTilt;
+		Vec3 m_translation;
+		Rotation m_YRot;
+		Rotation m_ZRot;
 		double m_deltaR_flat, m_deltaR_flat_ring, m_deltaPhi_flat_wedge;
-		TVector3 m_norm_flat;
+		Vec3 m_norm_flat;
+		Vec3 m_normTilted;
+		Vec3 m_xAxisTilted, m_yAxisTilted; //flat frame x and y unit vectors, rotated into the tilted frame
 		bool m_drawingFlag;
 		int m_detectorID;
 
-		std::uniform_real_distribution<double> m_channelSmear;
+		std::vector<Pixel> m_pixels; //ring major
 	
-		std::vector<std::vector<TVector3>> m_ringCoords_flat, m_wedgeCoords_flat;
-		std::vector<std::vector<TVector3>> m_ringCoords_tilt, m_wedgeCoords_tilt;
+		std::vector<std::vector<Vec3>> m_ringCoords_flat, m_wedgeCoords_flat;
+		std::vector<std::vector<Vec3>> m_ringCoords_tilt, m_wedgeCoords_tilt;
 	
 	};
 }
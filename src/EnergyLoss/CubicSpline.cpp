@@ -10,22 +10,23 @@ Gordon M. May 2021
 #include <fstream>
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 
 namespace PunchTable {
 
 	CubicSpline::CubicSpline() :
-		m_validFlag(false)
+		m_externalSplines(nullptr), m_nExternalSplines(0), m_uniformFlag(false), m_xMin(0.0), m_xMax(0.0), m_invStep(0.0), m_validFlag(false)
 	{
 	}
 
 	CubicSpline::CubicSpline(const std::string& filename) :
-		m_validFlag(false)
+		m_externalSplines(nullptr), m_nExternalSplines(0), m_uniformFlag(false), m_xMin(0.0), m_xMax(0.0), m_invStep(0.0), m_validFlag(false)
 	{
 		ReadFile(filename);
 	}
 
 	CubicSpline::CubicSpline(const std::vector<double>& x, const std::vector<double>& y) :
-		m_validFlag(false)
+		m_externalSplines(nullptr), m_nExternalSplines(0), m_uniformFlag(false), m_xMin(0.0), m_xMax(0.0), m_invStep(0.0), m_validFlag(false)
 	{
 		ReadData(x, y);
 	}
@@ -72,7 +73,8 @@ namespace PunchTable {
 
 	/*
 	After data is read in splines can be solved. Each data point is referred to as a knot. Endpoint conditions are
-	derivatives of neighbors must be equal and second derivatives must be zero (natural cubic splines). Solved using gaussian elimination.
+	derivatives of neighbors must be equal and second derivatives must be zero (natural cubic splines). The system is
+	tridiagonal, so only the three diagonals are stored and it is solved with the Thomas algorithm in O(n).
 	*/
 	void CubicSpline::MakeSplines()
 	{
@@ -83,78 +85,71 @@ namespace PunchTable {
 		}
 
 		int knots = m_dataX.size();
+		if(knots < 2)
+		{
+			std::cerr<<"Error at CubicSpline::MakeSplines! At least two knots are needed to generate splines."<<std::endl;
+			m_validFlag = false;
+			return;
+		}
 
-		//Matrix and vector data init
-		double** a = new double*[knots];
-		for(int i=0; i<knots; i++) 
-			a[i] = new double[knots];
-		double* b = new double[knots];
-		double* k = new double[knots];
+		//Diagonals of the matrix (lower[0] and upper[knots-1] unused), rhs and curvature vector
+		std::vector<double> lower(knots), diag(knots), upper(knots), b(knots), k(knots);
 
 		Spline s;
 		m_splines.clear();
-		double x0, x1, x2;
-		double y0, y1, y2;
+		m_splines.reserve(knots-1);
+		double dx0, dx1;
 
 		//Setup matrix eqn.
 		for(int i=0; i<knots; i++)
 		{
 			if(i == 0)
 			{
-				x1 = m_dataX[i];
-				x2 = m_dataX[i+1];
-				y1 = m_dataY[i];
-				y2 = m_dataY[i+1];
-				a[i][i] = 2.0/(x2-x1);
-				a[i][i+1] = 1.0/(x2-x1);
-				b[i] = 3.0*(y2-y1)/(std::pow((x2-x1), 2.0));
-	      		s.x1 = x1; s.x2 = x2;
-	      		s.y1 = y1; s.y2 = y2;
-	      		m_splines.push_back(s);
+				dx1 = m_dataX[i+1] - m_dataX[i];
+				diag[i] = 2.0/dx1;
+				upper[i] = 1.0/dx1;
+				b[i] = 3.0*(m_dataY[i+1]-m_dataY[i])/(dx1*dx1);
 			}
 			else if(i == (knots-1))
 			{
-				x0 = m_dataX[i-1];
-				x1 = m_dataX[i];
-	      		y0 = m_dataY[i-1];
-	      		y1 = m_dataY[i];
-	      		a[i][i-1] = 1.0/(x1-x0);
-	      		a[i][i] = 2.0/(x1-x0);
-	      		b[i] = 3.0*(y1-y0)/(std::pow((x1-x0), 2.0));
+				dx0 = m_dataX[i] - m_dataX[i-1];
+				lower[i] = 1.0/dx0;
+				diag[i] = 2.0/dx0;
+				b[i] = 3.0*(m_dataY[i]-m_dataY[i-1])/(dx0*dx0);
 			}
 			else
 			{
-		    	x0 = m_dataX[i-1]; 
-		    	x1 = m_dataX[i]; 
-		    	x2 = m_dataX[i+1];
-	      		y0 = m_dataY[i-1];
-	      		y1 = m_dataY[i];
-	      		y2 = m_dataY[i+1];
-	      		a[i][i-1] = 1.0/(x1-x0);
-	      		a[i][i] = 2.0/(x1-x0)+2.0/(x2-x1);
-	      		a[i][i+1] = 1.0/(x2-x1);
-	      		b[i] = 3.0*(y1-y0)/(std::pow((x1-x0), 2.0))+3.0*(y2-y1)/(std::pow((x2-x1), 2.0));
-	      		s.x1 = x1; s.x2 = x2;
-	      		s.y1 = y1; s.y2 = y2;
-	      		m_splines.push_back(s);
+				dx0 = m_dataX[i] - m_dataX[i-1];
+				dx1 = m_dataX[i+1] - m_dataX[i];
+				lower[i] = 1.0/dx0;
+				diag[i] = 2.0/dx0+2.0/dx1;
+				upper[i] = 1.0/dx1;
+				b[i] = 3.0*(m_dataY[i]-m_dataY[i-1])/(dx0*dx0)+3.0*(m_dataY[i+1]-m_dataY[i])/(dx1*dx1);
+			}
+
+			if(i != (knots-1))
+			{
+				s.x1 = m_dataX[i]; s.x2 = m_dataX[i+1];
+				s.y1 = m_dataY[i]; s.y2 = m_dataY[i+1];
+				m_splines.push_back(s);
 			}
 		}
 
-		//solve for curvature vector k using gaussian elimination
-		a[0][1] /= a[0][0];
-		b[0] /= a[0][0];
-		for(int i=1; i<(knots-1); i++)
+		//Forward sweep
+		upper[0] /= diag[0];
+		b[0] /= diag[0];
+		double denom;
+		for(int i=1; i<knots; i++)
 		{
-			a[i][i+1] /= a[i][i]-a[i][i-1]*a[i-1][i];
-	   	 	b[i] = (b[i] - a[i][i-1]*b[i-1])/(a[i][i]-a[i][i-1]*a[i-1][i]);
+			denom = diag[i]-lower[i]*upper[i-1];
+			upper[i] /= denom;
+			b[i] = (b[i] - lower[i]*b[i-1])/denom;
 		}
-		int g1 = knots-1;
-	  	int g2 = knots-2;
-	  	b[g1] = (b[g1]-a[g1][g2]*b[g2])/(a[g1][g1]-a[g1][g2]*a[g2][g1]);
 
-	  	k[g1] = b[g1];
+		//Back substitution for curvature vector k
+	  	k[knots-1] = b[knots-1];
 	  	for(int i=(knots-2); i>=0; i--)
-	    	k[i] = b[i] - a[i][i+1]*k[i+1];
+	    	k[i] = b[i] - upper[i]*k[i+1];
 
 	  	//Fill the spline data
 	  	for(size_t i=0; i<m_splines.size(); i++)
@@ -163,73 +158,125 @@ namespace PunchTable {
 	  		m_splines[i].k2 = k[i+1];
 	  	}
 
-	  	//deallocate
-	  	delete[] b;
-	  	delete[] k;
-	  	for(int i=0; i<knots; i++)
-	  		delete[] a[i];
-	  	delete[] a;
+	  	FindGrid();
 	}
 
-	double CubicSpline::Evaluate(double x)
+	void CubicSpline::SetSplines(const Spline* splines, std::size_t nSplines)
 	{
-		if(!m_validFlag)
+		m_dataX.clear();
+		m_dataY.clear();
+		m_splines.clear();
+		m_externalSplines = splines;
+		m_nExternalSplines = nSplines;
+		m_validFlag = splines != nullptr && nSplines != 0;
+		if(m_validFlag)
+			FindGrid();
+	}
+
+	/*Check for a uniform grid so that Evaluate can index the segment directly*/
+	void CubicSpline::FindGrid()
+	{
+		const Spline* splines = GetSplineData();
+		std::size_t nSplines = GetNumberOfSplines();
+		m_xMin = splines[0].x1;
+		m_xMax = splines[nSplines-1].x2;
+		double step = (m_xMax - m_xMin)/nSplines;
+		m_uniformFlag = step > 0.0;
+		for(std::size_t i=0; i<nSplines && m_uniformFlag; i++)
 		{
-			std::cerr<<"Error at CubicSpline::Evaluate! Unable to evaluate without first generating splines."<<std::endl;
-			return 0.0;
+			if(std::fabs((splines[i].x2 - splines[i].x1) - step) > s_uniformTolerance*step)
+				m_uniformFlag = false;
 		}
+		m_invStep = m_uniformFlag ? 1.0/step : 0.0;
+	}
 
-		Spline s;
-		for(size_t i=0; i<m_splines.size(); i++)
+	/*
+	Returns the index of the spline segment containing x, or -1 if x is outside of the knots. Knots shared by two segments
+	belong to the lower segment. Uniform grids are indexed directly (with a one step correction for rounding), otherwise
+	the knots are binary searched.
+	*/
+	int CubicSpline::FindSpline(double x) const
+	{
+		if(!(x >= m_xMin && x <= m_xMax))
+			return -1;
+
+		const Spline* splines = GetSplineData();
+		int last = GetNumberOfSplines() - 1;
+		int index;
+		if(m_uniformFlag)
 		{
-			auto& spline = m_splines[i];
-			if(x >= spline.x1 && x <= spline.x2)
-			{
-				s = spline;
-				break;
-			}
-			else if (i == (m_splines.size() -1))
-			{
-				//std::cerr<<"Error at CubicSpline::Evaluate! Input x value: "<<x<<" is not within the spline range min: "<<m_splines[0].x1<<" max: "<<m_splines[m_splines.size()-1].x2<<std::endl;
-				return 0.0;
-			}
+			index = std::min(int((x - m_xMin)*m_invStep), last);
+			if(index > 0 && x <= splines[index].x1)
+				index--;
+			else if(index < last && x > splines[index].x2)
+				index++;
 		}
+		else
+		{
+			//first segment whose upper knot is not below x
+			index = std::lower_bound(splines, splines + last, x, [](const Spline& s, double value) { return s.x2 < value; }) - splines;
+		}
+		return index;
+	}
 
+	double CubicSpline::EvaluateSpline(const Spline& s, double x) const
+	{
 		double t = (x-s.x1)/(s.x2-s.x1);
 	    double a = s.k1*(s.x2-s.x1)-(s.y2-s.y1);
 	    double b = -s.k2*(s.x2-s.x1)+(s.y2-s.y1);
 	    return (1.0-t)*s.y1+t*s.y2+t*(1.0-t)*((1.0-t)*a+t*b);
 	}
 
-	//Purely for plotting in ROOT, do not use for caluculations. 
-	double CubicSpline::EvaluateROOT(double* x, double* p)
+	double CubicSpline::Evaluate(double x) const
 	{
 		if(!m_validFlag)
 		{
-			std::cerr<<"Error at CubicSpline::EvaluateROOT! Unable to evaluate without first generating splines."<<std::endl;
+			std::cerr<<"Error at CubicSpline::Evaluate! Unable to evaluate without first generating splines."<<std::endl;
 			return 0.0;
 		}
 
-		double xval = x[0];
-		Spline s;
-		for(size_t i=0; i<m_splines.size(); i++)
+		int index = FindSpline(x);
+		if(index == -1)
 		{
-			auto& spline = m_splines[i];
-			if(xval >= spline.x1 && xval <= spline.x2)
-			{
-				s = spline;
-				break;
-			}
-			else if (i == (m_splines.size() -1))
-			{
-				return 0.0;
-			}
+			//std::cerr<<"Error at CubicSpline::Evaluate! Input x value: "<<x<<" is not within the spline range min: "<<m_xMin<<" max: "<<m_xMax<<std::endl;
+			return 0.0;
 		}
 
-		double t = (xval-s.x1)/(s.x2-s.x1);
-	    double a = s.k1*(s.x2-s.x1)-(s.y2-s.y1);
-	    double b = -s.k2*(s.x2-s.x1)+(s.y2-s.y1);
-	    return (1.0-t)*s.y1+t*s.y2+t*(1.0-t)*((1.0-t)*a+t*b);
+		return EvaluateSpline(GetSplineData()[index], x);
+	}
+
+	void CubicSpline::Evaluate(const double* x, double* result, std::size_t n) const
+	{
+		if(!m_validFlag)
+		{
+			std::cerr<<"Error at CubicSpline::Evaluate! Unable to evaluate without first generating splines."<<std::endl;
+			std::fill(result, result + n, 0.0);
+			return;
+		}
+
+		const Spline* splines = GetSplineData();
+		int index;
+		for(std::size_t i=0; i<n; i++)
+		{
+			index = FindSpline(x[i]);
+			result[i] = index == -1 ? 0.0 : EvaluateSpline(splines[index], x[i]);
+		}
+	}
+
+	//Purely for plotting in ROOT, do not use for caluculations. 
+	double CubicSpline::EvaluateROOT(double* x, double* p) const
+	{
+		if(!m_validFlag)
+		{
+			std::cerr<<"Error at CubicSpline::EvaluateROOT! Unable to evaluate without first generating splines."<<std::endl;
+			return 0.0;
+		}
+
+		int index = FindSpline(x[0]);
+		if(index == -1)
+			return 0.0;
+
+		return EvaluateSpline(GetSplineData()[index], x[0]);
 	}
 
-}
\ No newline at end of file
+}
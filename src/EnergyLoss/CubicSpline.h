@@ -11,10 +11,11 @@ Gordon M. May 2021
 
 #include <vector>
 #include <string>
+#include <cstddef>
 
 namespace PunchTable {
 
-	//struct holding final spline info
+	//struct holding final spline info. Plain data, written as-is to binary table files
 	struct Spline
 	{
 		double y1=0, y2=0;
@@ -37,18 +38,37 @@ namespace PunchTable {
 			m_validFlag=true;
 			MakeSplines();
 		}
-		bool IsValid() { return m_validFlag; }
-		double Evaluate(double x);
-		double EvaluateROOT(double* x, double* p); //for plotting as ROOT function
+		//Use precomputed segments owned elsewhere (i.e. a mapped table file). The memory must outlive the spline.
+		void SetSplines(const Spline* splines, std::size_t nSplines);
+		bool IsValid() const { return m_validFlag; }
+		bool IsUniform() const { return m_uniformFlag; }
+		double Evaluate(double x) const;
+		void Evaluate(const double* x, double* result, std::size_t n) const; //batch version, one validity check per call
+		double EvaluateROOT(double* x, double* p) const; //for plotting as ROOT function
+
+		inline const Spline* GetSplineData() const { return m_splines.empty() ? m_externalSplines : m_splines.data(); }
+		inline std::size_t GetNumberOfSplines() const { return m_splines.empty() ? m_nExternalSplines : m_splines.size(); }
 
 	private:
 		void MakeSplines();
+		void FindGrid();
+		int FindSpline(double x) const;
+		double EvaluateSpline(const Spline& s, double x) const;
 
 		std::vector<double> m_dataX;
 		std::vector<double> m_dataY;
 		std::vector<Spline> m_splines;
+		const Spline* m_externalSplines;
+		std::size_t m_nExternalSplines;
+
+		//Uniform knot spacing lets the segment be indexed directly instead of searched for
+		bool m_uniformFlag;
+		double m_xMin, m_xMax;
+		double m_invStep;
 
 		bool m_validFlag;
+
+		static constexpr double s_uniformTolerance = 1.0e-6; //relative to the knot spacing
 	};
 
 }
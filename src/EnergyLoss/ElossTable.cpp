@@ -1,17 +1,18 @@
 #include "ElossTable.h"
 #include <iostream>
+#include <algorithm>
 #include <iomanip>
 #include <fstream>
 
 namespace PunchTable {
 
     ElossTable::ElossTable() :
-        m_isValid(false)
+        m_interpolateTheta(false), m_uniformTheta(false), m_isValid(false)
     {
     }
 
     ElossTable::ElossTable(const std::string& filename) :
-        m_isValid(false)
+        m_interpolateTheta(false), m_uniformTheta(false), m_isValid(false)
     {
         ReadFile(filename);
     }
@@ -20,6 +21,13 @@ namespace PunchTable {
 
     void ElossTable::ReadFile(const std::string& filename)
     {
+        m_surface = SplineSurface(); //rebuilt from the new splines if interpolating
+        if(TableFile::IsTableFile(filename))
+        {
+            ReadBinaryFile(filename);
+            return;
+        }
+
         std::ifstream input(filename);
 		if(!input.is_open())
 		{
@@ -33,18 +41,9 @@ namespace PunchTable {
 		double theta;
 		double value;
 		std::vector<double> energyLoss, energyFinal;
+		std::vector<double> rowTheta;
 
-		input>>junk>>junk>>m_projectileString;
-		input>>junk>>junk;
-
-		while(input>>junk)
-		{
-			if(junk == "---------------------------------")
-				break;
-			input>>junk;
-			m_materialString += junk;
-			input>>junk;
-		}
+		TableFile::ReadTextHeader(input, m_projectileString, m_materialString);
 		input>>junk>>m_thetaMin>>junk>>m_thetaMax>>junk>>m_thetaStep;
 		std::getline(input, junk);
 		std::getline(input, junk);
@@ -57,6 +56,7 @@ namespace PunchTable {
 				energyLoss.clear();
 				energyFinal.clear();
 				input>>theta;
+				rowTheta.push_back(theta);
 				while(input>>junk)
 				{
 					if(junk == "end_theta")
@@ -79,7 +79,78 @@ namespace PunchTable {
 			}
 		}
 
+		if(m_splines.empty())
+		{
+			std::cerr<<"Energy loss table "<<filename<<" has no theta bins!"<<std::endl;
+			m_isValid = false;
+			return;
+		}
+
+		m_uniformTheta = TableFile::IsUniformThetaGrid(rowTheta, m_thetaMin, m_thetaStep);
+		if(!m_uniformTheta)
+			std::cerr<<"WARN -- Energy loss table "<<filename<<" theta bins are not uniform from "<<m_thetaMin<<" in steps of "<<m_thetaStep
+					 <<"; theta interpolation is unavailable"<<std::endl;
+
 		m_isValid = true;
+		if(m_interpolateTheta)
+			BuildSurface();
+    }
+
+    /*Binary tables carry solved splines; the splines point straight into the mapped file*/
+    void ElossTable::ReadBinaryFile(const std::string& filename)
+    {
+        m_splines.clear();
+        m_tableFile = std::make_shared<TableFile>();
+        if(!m_tableFile->Open(filename, TableType::Eloss))
+        {
+            m_isValid = false;
+            return;
+        }
+
+        const TableFileHeader& header = m_tableFile->GetHeader();
+        m_projectileString = m_tableFile->GetProjectile();
+        m_materialString = m_tableFile->GetMaterial();
+        m_thetaMin = header.thetaMin;
+        m_thetaMax = header.thetaMax;
+        m_thetaStep = header.thetaStep;
+        m_splines.resize(header.nThetaBins);
+        for(uint64_t i=0; i<header.nThetaBins; i++)
+            m_tableFile->SetSpline(i, m_splines[i]);
+
+        m_uniformTheta = true;
+
+        m_isValid = true;
+        if(m_interpolateTheta)
+            BuildSurface();
+    }
+
+    /*The surface resamples every theta bin, so it is only built for tables that interpolate in theta*/
+    void ElossTable::SetInterpolateTheta(bool interpolate)
+    {
+        m_interpolateTheta = interpolate;
+        if(m_interpolateTheta && m_isValid)
+            BuildSurface();
+    }
+
+    void ElossTable::BuildSurface()
+    {
+        if(m_uniformTheta && !m_surface.IsValid())
+            m_surface.Build(m_thetaMin, m_thetaStep, m_splines);
+    }
+
+    bool ElossTable::WriteBinaryFile(const std::string& filename) const
+    {
+        if(!m_isValid)
+        {
+            std::cerr<<"ElossTable not initialized at WriteBinaryFile()"<<std::endl;
+            return false;
+        }
+        else if(!m_uniformTheta)
+        {
+            std::cerr<<"ElossTable with non-uniform theta bins cannot be written to a binary file"<<std::endl;
+            return false;
+        }
+        return TableFile::Write(filename, TableType::Eloss, m_projectileString, m_materialString, m_thetaMin, m_thetaMax, m_thetaStep, m_splines);
     }
 
     double ElossTable::GetEnergyLoss(double thetaIncident, double finalEnergy)
@@ -96,7 +167,11 @@ namespace PunchTable {
 			return 0.0;
 		}
 
-		int theta_bin = (thetaIncident - m_thetaMin)/m_thetaStep;
+		if(m_interpolateTheta && m_surface.IsValid())
+			return m_surface.Evaluate(thetaIncident, finalEnergy);
+
+		//Clamped in floating point first, so a theta at the edge of the grid (or NaN) cannot index past the splines
+		int theta_bin = std::max(0.0, std::min((thetaIncident - m_thetaMin)/m_thetaStep, double(m_splines.size() - 1)));
 
 		//std::cout<<"theta bin: "<<theta_bin<<" theta_inc: "<<thetaIncident<<std::endl;
 
@@ -117,4 +192,37 @@ namespace PunchTable {
 			return 0.0;
         }
     }
+
+    /*Theta is converted to degrees a chunk at a time so that the surface can be evaluated in blocks*/
+    void ElossTable::GetEnergyLoss(const double* thetaIncident, const double* finalEnergy, double* eloss, std::size_t n)
+    {
+        if(!m_isValid)
+        {
+            std::cerr<<"ElossTable not initialized at GetEnergyLoss()"<<std::endl;
+            std::fill(eloss, eloss + n, 0.0);
+            return;
+        }
+        else if(!m_interpolateTheta || !m_surface.IsValid())
+        {
+            for(std::size_t i=0; i<n; i++)
+                eloss[i] = GetEnergyLoss(thetaIncident[i], finalEnergy[i]);
+            return;
+        }
+
+        double thetaDeg[s_batchChunk];
+        std::size_t count;
+        for(std::size_t start=0; start<n; start += s_batchChunk)
+        {
+            count = std::min(s_batchChunk, n - start);
+            for(std::size_t i=0; i<count; i++)
+                thetaDeg[i] = thetaIncident[start+i]/s_deg2rad;
+            m_surface.Evaluate(thetaDeg, finalEnergy + start, eloss + start, count);
+            for(std::size_t i=0; i<count; i++)
+            {
+                if(thetaDeg[i] < m_thetaMin || thetaDeg[i] > m_thetaMax)
+                    eloss[start+i] = 0.0;
+            }
+        }
+    }
+
 }
\ No newline at end of file
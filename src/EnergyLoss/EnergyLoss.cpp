@@ -2,91 +2,256 @@
 #include "EnergyLossConstants.h"
 #include <cstdlib>
 #include <cmath>
+#include <algorithm>
+#include <iostream>
 
 namespace SabreRecon {
 
 	namespace EnergyLoss {
 
-		double GetEnergyLoss(const Parameters& params)
+		/*
+			Integrate dE/dx = sign*S(E) over params.thickness with an embedded Dormand-Prince 5(4) pair. The difference between
+			the 5th and 4th order solutions estimates the local error, which is held below tolerance*E; the step is grown or shrunk
+			accordingly. The last stage of an accepted step is the first stage of the next (FSAL), so an accepted step costs six
+			stopping power evaluations. sign = -1 for forward (energy loss), +1 for reverse.
+		*/
+		static IntegrationResult Integrate(const Parameters& params, double sign, double tolerance)
 		{
-	
+			IntegrationResult result;
 			if(params.thickness == 0.0 || params.energy == 0.0 || params.ZP == 0)
-				return 0.0;
+				return result;
 
+			//Dormand-Prince tableau
+			static constexpr double a21 = 1.0/5.0;
+			static constexpr double a31 = 3.0/40.0, a32 = 9.0/40.0;
+			static constexpr double a41 = 44.0/45.0, a42 = -56.0/15.0, a43 = 32.0/9.0;
+			static constexpr double a51 = 19372.0/6561.0, a52 = -25360.0/2187.0, a53 = 64448.0/6561.0, a54 = -212.0/729.0;
+			static constexpr double a61 = 9017.0/3168.0, a62 = -355.0/33.0, a63 = 46732.0/5247.0, a64 = 49.0/176.0, a65 = -5103.0/18656.0;
+			static constexpr double b1 = 35.0/384.0, b3 = 500.0/1113.0, b4 = 125.0/192.0, b5 = -2187.0/6784.0, b6 = 11.0/84.0;
+			static constexpr double e1 = 71.0/57600.0, e3 = -71.0/16695.0, e4 = 71.0/1920.0, e5 = -17253.0/339200.0, e6 = 22.0/525.0, e7 = -1.0/40.0;
 
-			double energyFinal = params.energy;
-			double xTraversed = 0;
-			double xStep = 0.25*params.thickness; //initial step in x
-			double energyStep = GetTotalStoppingPower(params, energyFinal)*xStep/1000.0; //initial step in e
-			double energyThreshold = 0.05*params.energy;
-		
-			int depth=0;
-		
-			while(true)
+			//keV/(ug/cm^2) -> MeV/(ug/cm^2)
+			auto derivative = [&](double energy)
 			{
-				//If intial guess of step size is too large, shrink until in range
-				if(energyStep/energyFinal > maxFracStep && depth < maxDepth)
+				result.stoppingEvaluations++;
+				return sign*GetTotalStoppingPower(params, energy)/1000.0;
+			};
+
+			double energy = params.energy;
+			double energyThreshold = stoppedFraction*params.energy;
+			double xTraversed = 0.0;
+			double xStep = params.thickness; //optimistic; the error control shrinks it as needed
+			double minStep = minStepFraction*params.thickness;
+			double k1 = derivative(energy), k2, k3, k4, k5, k6, k7;
+			double stage, energyNew, error, scale;
+
+			while(xTraversed < params.thickness)
+			{
+				if(result.steps + result.rejectedSteps >= maxIntegrationSteps)
 				{
-					depth++;
-					xStep *= 0.5;
-					energyStep = GetTotalStoppingPower(params, energyFinal)*xStep/1000.0;
+					result.status = IntegrationStatus::MaxSteps;
+					break;
 				}
-				else if((xStep + xTraversed) >= params.thickness)
-				{ //last chunk
-				  	xStep = params.thickness - xTraversed; //get valid portion of last chunk
-				  	energyFinal -= GetTotalStoppingPower(params, energyFinal)*xStep/1000.0;
-					if(energyFinal <= energyThreshold)
-						return params.energy;
-					else
-						break;
-				} 
-				else if(depth == maxDepth)
+				else if(xStep < minStep)
 				{
-					return params.energy;
+					result.status = IntegrationStatus::StepUnderflow;
+					break;
 				}
-				else
+
+				xStep = std::min(xStep, params.thickness - xTraversed);
+
+				//A stage below zero energy means the step runs past the end of the particle's range; retry shorter
+				stage = energy + xStep*a21*k1;
+				if(stage <= 0.0) { xStep *= 0.5; result.rejectedSteps++; continue; }
+				k2 = derivative(stage);
+				stage = energy + xStep*(a31*k1 + a32*k2);
+				if(stage <= 0.0) { xStep *= 0.5; result.rejectedSteps++; continue; }
+				k3 = derivative(stage);
+				stage = energy + xStep*(a41*k1 + a42*k2 + a43*k3);
+				if(stage <= 0.0) { xStep *= 0.5; result.rejectedSteps++; continue; }
+				k4 = derivative(stage);
+				stage = energy + xStep*(a51*k1 + a52*k2 + a53*k3 + a54*k4);
+				if(stage <= 0.0) { xStep *= 0.5; result.rejectedSteps++; continue; }
+				k5 = derivative(stage);
+				stage = energy + xStep*(a61*k1 + a62*k2 + a63*k3 + a64*k4 + a65*k5);
+				if(stage <= 0.0) { xStep *= 0.5; result.rejectedSteps++; continue; }
+				k6 = derivative(stage);
+				energyNew = energy + xStep*(b1*k1 + b3*k3 + b4*k4 + b5*k5 + b6*k6);
+				if(energyNew <= 0.0) { xStep *= 0.5; result.rejectedSteps++; continue; }
+				k7 = derivative(energyNew);
+
+				error = std::fabs(xStep*(e1*k1 + e3*k3 + e4*k4 + e5*k5 + e6*k6 + e7*k7))/(tolerance*std::max(energy, energyNew));
+				scale = error == 0.0 ? 5.0 : std::min(5.0, std::max(0.2, 0.9*std::pow(error, -0.2)));
+				if(error > 1.0)
+				{
+					xStep *= scale;
+					result.rejectedSteps++;
+					continue;
+				}
+
+				result.steps++;
+				xTraversed += xStep;
+				energy = energyNew;
+				k1 = k7;
+				xStep *= scale;
+
+				if(energy <= energyThreshold)
 				{
-					xTraversed += xStep;
-					energyStep = GetTotalStoppingPower(params, energyFinal)*xStep/1000.0;
-					energyFinal -= energyStep;
-					if(energyFinal <= energyThreshold)
-						return params.energy;
+					result.status = IntegrationStatus::Stopped;
+					break;
 				}
 			}
-			return params.energy - energyFinal;
+
+			result.energyLoss = std::fabs(energy - params.energy);
+			return result;
+		}
+
+		IntegrationResult IntegrateEnergyLoss(const Parameters& params, double tolerance)
+		{
+			IntegrationResult result = Integrate(params, -1.0, tolerance);
+			if(result.status == IntegrationStatus::Stopped)
+				result.energyLoss = params.energy;
+			return result;
+		}
+
+		IntegrationResult IntegrateReverseEnergyLoss(const Parameters& params, double tolerance)
+		{
+			return Integrate(params, 1.0, tolerance);
+		}
+
+		const char* GetStatusString(IntegrationStatus status)
+		{
+			switch(status)
+			{
+				case IntegrationStatus::Success: return "Success";
+				case IntegrationStatus::Stopped: return "Stopped";
+				case IntegrationStatus::MaxSteps: return "MaxSteps";
+				case IntegrationStatus::StepUnderflow: return "StepUnderflow";
+			}
+			return "Unknown";
+		}
+
+		//A particle which stops in the material is reported as losing all of its energy
+		double GetEnergyLoss(const Parameters& params)
+		{
+			IntegrationResult result = IntegrateEnergyLoss(params);
+			if(result.status == IntegrationStatus::MaxSteps || result.status == IntegrationStatus::StepUnderflow)
+				std::cerr<<"WARN -- EnergyLoss::GetEnergyLoss failed with status "<<GetStatusString(result.status)<<" after "<<result.steps<<" steps"<<std::endl;
+			return result.energyLoss;
 		}
 	
 		double GetReverseEnergyLoss(const Parameters& params)
 		{
-			double energyInitial = params.energy;
-			double xTraversed = 0.0;
-			double xStep = 0.25*params.thickness; //initial step in x
-			double energyStep = GetTotalStoppingPower(params, energyInitial)*xStep/1000.0; //initial step in E
-		
-			while(true)
+			IntegrationResult result = IntegrateReverseEnergyLoss(params);
+			if(result.status != IntegrationStatus::Success)
+				std::cerr<<"WARN -- EnergyLoss::GetReverseEnergyLoss failed with status "<<GetStatusString(result.status)<<" after "<<result.steps<<" steps"<<std::endl;
+			return result.energyLoss;
+		}
+
+		/*
+			Tabulate R(E) = integral of dE/S(E) on a log spaced energy grid using Simpson's rule in ln(E) for each interval.
+			Below the first node the stopping power goes as sqrt(E) so R(Emin) = 2*Emin/S(Emin).
+			Uses params.ZP, params.massP and the target coefficients; energy and thickness are ignored.
+		*/
+		bool BuildRangeTable(const Parameters& params, RangeTable& table)
+		{
+			table.ZP = params.ZP;
+			table.massP = params.massP;
+			table.energy.clear();
+			table.range.clear();
+			table.stopping.clear();
+			if(params.ZP == 0 || params.coeffs.nElements == 0)
+				return false;
+
+			table.logEnergyMin = std::log(rangeTableEnergyMin);
+			table.logEnergyStep = (std::log(rangeTableEnergyMax) - table.logEnergyMin)/(rangeTablePoints - 1);
+			table.energy.resize(rangeTablePoints);
+			table.range.resize(rangeTablePoints);
+			table.stopping.resize(rangeTablePoints);
+
+			double energy, energyMid, stoppingMid;
+			for(int i=0; i<rangeTablePoints; i++)
 			{
-				if(energyStep/energyInitial > maxFracStep)
+				energy = std::exp(table.logEnergyMin + i*table.logEnergyStep);
+				table.energy[i] = energy;
+				table.stopping[i] = GetTotalStoppingPower(params, energy);
+				if(table.stopping[i] <= 0.0)
 				{
-					xStep *= 0.5;
-					energyStep = GetTotalStoppingPower(params, energyInitial)*xStep/1000.0;
+					table.energy.clear();
+					table.range.clear();
+					table.stopping.clear();
+					return false;
 				}
-				else if (xTraversed+xStep > params.thickness)
-				{
-					xStep = params.thickness - xTraversed;
-					energyInitial += GetTotalStoppingPower(params, energyInitial)*xStep/1000.0;
-					break;
-				}
-				else
+
+				if(i == 0)
 				{
-					xTraversed += xStep;
-					energyStep = GetTotalStoppingPower(params, energyInitial)*xStep/1000.0;
-					energyInitial += energyStep;
+					table.range[i] = 2.0*energy*1000.0/table.stopping[i];
+					continue;
 				}
+
+				//dR/dln(E) = E/S(E); keV -> MeV conversion of the stopping power
+				energyMid = std::exp(table.logEnergyMin + (i - 0.5)*table.logEnergyStep);
+				stoppingMid = GetTotalStoppingPower(params, energyMid);
+				table.range[i] = table.range[i-1] + 1000.0*table.logEnergyStep/6.0*(table.energy[i-1]/table.stopping[i-1]
+								 + 4.0*energyMid/stoppingMid + energy/table.stopping[i]);
 			}
-		
-			return energyInitial-params.energy;
+			return true;
 		}
-	
+
+		//Returns the range in ug/cm^2 for a given energy in MeV
+		double GetRange(const RangeTable& table, double energy)
+		{
+			if(table.energy.empty() || energy <= 0.0)
+				return 0.0;
+
+			int last = table.energy.size() - 1;
+			if(energy < table.energy[0])
+				return table.range[0]*std::sqrt(energy/table.energy[0]);
+			else if(energy >= table.energy[last])
+				return table.range[last] + (energy - table.energy[last])*1000.0/table.stopping[last];
+
+			int i = std::min(int((std::log(energy) - table.logEnergyMin)/table.logEnergyStep), last-1);
+			double h = table.energy[i+1] - table.energy[i];
+			double t = (energy - table.energy[i])/h;
+			double t2 = t*t, t3 = t2*t;
+			return (2.0*t3 - 3.0*t2 + 1.0)*table.range[i] + (t3 - 2.0*t2 + t)*h*1000.0/table.stopping[i]
+				   + (-2.0*t3 + 3.0*t2)*table.range[i+1] + (t3 - t2)*h*1000.0/table.stopping[i+1];
+		}
+
+		//Inverse of GetRange; the range grid is monotonic so the interval is found by bisection
+		double GetEnergyFromRange(const RangeTable& table, double range)
+		{
+			if(table.range.empty() || range <= 0.0)
+				return 0.0;
+
+			int last = table.range.size() - 1;
+			if(range < table.range[0])
+				return table.energy[0]*(range/table.range[0])*(range/table.range[0]);
+			else if(range >= table.range[last])
+				return table.energy[last] + (range - table.range[last])*table.stopping[last]/1000.0;
+
+			int i = std::upper_bound(table.range.begin(), table.range.end(), range) - table.range.begin() - 1;
+			double h = table.range[i+1] - table.range[i];
+			double t = (range - table.range[i])/h;
+			double t2 = t*t, t3 = t2*t;
+			return (2.0*t3 - 3.0*t2 + 1.0)*table.energy[i] + (t3 - 2.0*t2 + t)*h*table.stopping[i]/1000.0
+				   + (-2.0*t3 + 3.0*t2)*table.energy[i+1] + (t3 - t2)*h*table.stopping[i+1]/1000.0;
+		}
+
+		//Thickness in ug/cm^2. Like GetEnergyLoss, a particle which stops in the material loses all of its energy
+		double GetEnergyLossFromRange(const RangeTable& table, double energy, double thickness)
+		{
+			double residualRange = GetRange(table, energy) - thickness;
+			if(residualRange <= 0.0)
+				return energy;
+			return energy - GetEnergyFromRange(table, residualRange);
+		}
+
+		double GetReverseEnergyLossFromRange(const RangeTable& table, double energy, double thickness)
+		{
+			return GetEnergyFromRange(table, GetRange(table, energy) + thickness) - energy;
+		}
+
 		/*Wrapper function for aquiring total stopping (elec + nuc)*/
 		double GetTotalStoppingPower(const Parameters& params, double current_energy)
 		{
@@ -96,54 +261,80 @@ namespace SabreRecon {
 			return GetElectronicStoppingPower(params, current_energy)+GetNuclearStoppingPower(params, current_energy);
 		}
 	
+		/*Copy the constants for each target element; returns false if the target can't be represented*/
+		bool InitCoefficients(Parameters& params)
+		{
+			Coefficients& coeffs = params.coeffs;
+			coeffs.nElements = 0;
+			if(params.ZT.size() > maxTargetElements || params.ZT.size() != params.composition.size())
+				return false;
+
+			double conversion_factor = 0;
+			for(size_t i=0; i<params.ZT.size(); i++)
+			{
+				int z = params.ZT[i];
+				if(z <= 0 || z >= MAX_Z)
+					return false;
+
+				coeffs.ZT[i] = z;
+				coeffs.composition[i] = params.composition[i];
+				for(int j=0; j<12; j++)
+					coeffs.hydrogen[i][j] = hydrogenCoefficients[z][j];
+				coeffs.massT[i] = naturalMassList[z];
+				coeffs.zt23[i] = std::pow(z, 2.0/3.0);
+				coeffs.nuclearConversion[i] = avogadro/coeffs.massT[i];
+				conversion_factor += params.composition[i]*naturalMassList[z];
+			}
+			coeffs.electronicConversion = avogadro/conversion_factor;
+			coeffs.nElements = params.ZT.size();
+			return true;
+		}
+
 		/*Charge rel to H*/
 		double GetElectronicStoppingPower(const Parameters& params, double current_energy)
 		{
+			const Coefficients& coeffs = params.coeffs;
 			//Wants in units of keV
 			current_energy *= 1000.0;
 			double ePerU = current_energy/params.massP;
-			std::vector<double> values;
+			double values[maxTargetElements];
 			if(ePerU > maxHEperU)
 			{
 				return 0.0;
 			}
 			else if (ePerU > 1000.0)
 			{
-				for(auto& z: params.ZT)
-					values.push_back(Hydrogen_dEdx_High(ePerU, params.massP, current_energy, z));
+				for(int i=0; i<coeffs.nElements; i++)
+					values[i] = Hydrogen_dEdx_High(ePerU, params.massP, current_energy, coeffs.hydrogen[i]);
 			}
 			else if (ePerU > 10.0)
 			{
-				for(auto& z: params.ZT)
-					values.push_back(Hydrogen_dEdx_Med(ePerU, z));
+				for(int i=0; i<coeffs.nElements; i++)
+					values[i] = Hydrogen_dEdx_Med(ePerU, coeffs.hydrogen[i]);
 			}
 			else if (ePerU > 0.0)
 			{
-				for(auto& z: params.ZT)
-					values.push_back(Hydrogen_dEdx_Low(ePerU, z));
+				for(int i=0; i<coeffs.nElements; i++)
+					values[i] = Hydrogen_dEdx_Low(ePerU, coeffs.hydrogen[i]);
 			}
 			else
 			{
 				return 0.0;
 			}
 		
-			if(values.size() == 0)
+			if(coeffs.nElements == 0)
 				return 0.0; //bad
 		
 			if(params.ZP > 1)
 			{ //not hydrogen, need to account for effective charge
-				for(unsigned int i=0; i<values.size(); i++)
-					values[i] *= CalculateEffectiveChargeRatio(ePerU, params.ZP, params.ZT[i]);
+				for(int i=0; i<coeffs.nElements; i++)
+					values[i] *= CalculateEffectiveChargeRatio(ePerU, params.ZP, coeffs.ZT[i]);
 			}
 			
 			double stopping_total = 0;
-			double conversion_factor = 0;
-			for(size_t i=0; i< params.ZT.size(); i++)
-			{
-				conversion_factor += params.composition[i]*naturalMassList[params.ZT[i]];
-				stopping_total += values[i]*params.composition[i];
-			}
-			stopping_total *= avogadro/conversion_factor;
+			for(int i=0; i<coeffs.nElements; i++)
+				stopping_total += values[i]*coeffs.composition[i];
+			stopping_total *= coeffs.electronicConversion;
 		
 			return stopping_total;
 		}
@@ -151,42 +342,42 @@ namespace SabreRecon {
 		//Returns units of keV/(ug/cm^2)
 		double GetNuclearStoppingPower(const Parameters& params, double energy)
 		{
+			const Coefficients& coeffs = params.coeffs;
 			energy *= 1000.0;
 			double stopping_total = 0.0;
-			double sn, x, epsilon, conversion_factor, massT;
-			for(size_t i=0; i<params.ZT.size(); i++)
+			double sn, x, epsilon;
+			double zp23 = std::pow(params.ZP, 2.0/3.0);
+			for(int i=0; i<coeffs.nElements; i++)
 			{
-				massT = naturalMassList[params.ZT[i]];
-				x = (params.massP + massT) * std::sqrt(std::pow(params.ZP, 2.0/3.0) + std::pow(params.ZT[i], 2.0/3.0));
-				epsilon = 32.53*massT*energy/(params.ZP*params.ZT[i]*x);
-				sn = 8.462*(0.5*std::log(1.0+epsilon)/(epsilon+0.10718*std::pow(epsilon, 0.37544)))*params.ZP*params.ZT[i]*params.massP/x;
-				conversion_factor = avogadro/massT;
-				stopping_total += sn*conversion_factor*params.composition[i];
+				x = (params.massP + coeffs.massT[i]) * std::sqrt(zp23 + coeffs.zt23[i]);
+				epsilon = 32.53*coeffs.massT[i]*energy/(params.ZP*coeffs.ZT[i]*x);
+				sn = 8.462*(0.5*std::log(1.0+epsilon)/(epsilon+0.10718*std::pow(epsilon, 0.37544)))*params.ZP*coeffs.ZT[i]*params.massP/x;
+				stopping_total += sn*coeffs.nuclearConversion[i]*coeffs.composition[i];
 			}
 		
 			return stopping_total;
 		}
 	
-		double Hydrogen_dEdx_Low(double ePerU, int z)
+		double Hydrogen_dEdx_Low(double ePerU, const double* coeffs)
 		{
-			return std::sqrt(ePerU)*hydrogenCoefficients[z][0];
+			return std::sqrt(ePerU)*coeffs[0];
 		}
 	
-		double Hydrogen_dEdx_Med(double ePerU, int z)
+		double Hydrogen_dEdx_Med(double ePerU, const double* coeffs)
 		{
-			double x = hydrogenCoefficients[z][1]*std::pow(ePerU, 0.45);
-			double y = hydrogenCoefficients[z][2]/ePerU * std::log(1.0+hydrogenCoefficients[z][3]/ePerU+hydrogenCoefficients[z][4]*ePerU);
+			double x = coeffs[1]*std::pow(ePerU, 0.45);
+			double y = coeffs[2]/ePerU * std::log(1.0+coeffs[3]/ePerU+coeffs[4]*ePerU);
 			return x*y/(x+y);
 		}
 	
-		double Hydrogen_dEdx_High(double ePerU, double massP, double energy, int z)
+		double Hydrogen_dEdx_High(double ePerU, double massP, double energy, const double* coeffs)
 		{
 			energy /= 1000.0; //back to MeV for ease of beta calc
 			double beta_sq = energy * (energy+2.0*massP/mev2u)/std::pow(energy+massP/mev2u, 2.0);
-			double alpha = hydrogenCoefficients[z][5]/beta_sq;
-			double epsilon = hydrogenCoefficients[z][6]*beta_sq/(1.0-beta_sq) - beta_sq - hydrogenCoefficients[z][7];
+			double alpha = coeffs[5]/beta_sq;
+			double epsilon = coeffs[6]*beta_sq/(1.0-beta_sq) - beta_sq - coeffs[7];
 			for(int i=1; i<5; i++)
-				epsilon += hydrogenCoefficients[z][7+i]*std::pow(std::log(ePerU), i);
+				epsilon += coeffs[7+i]*std::pow(std::log(ePerU), i);
 		
 			return alpha * std::log(epsilon);
 		}
@@ -18,6 +18,25 @@ namespace SabreRecon {
 
 	namespace EnergyLoss {
 
+		static constexpr int maxTargetElements = 8;
+		static constexpr double defaultTolerance = 1.0e-6; //relative error per integration step
+
+		/*
+			Per-target constants used by the stopping powers, copied out of EnergyLossConstants.h once per target
+			so that evaluation needs no lookups by Z and no heap storage. Filled by InitCoefficients.
+		*/
+		struct Coefficients
+		{
+			int nElements = 0;
+			int ZT[maxTargetElements];
+			double composition[maxTargetElements];
+			double hydrogen[maxTargetElements][12];
+			double massT[maxTargetElements];
+			double zt23[maxTargetElements]; //ZT^(2/3)
+			double nuclearConversion[maxTargetElements]; //avogadro/massT
+			double electronicConversion = 0.0; //avogadro/(sum of composition*massT)
+		};
+
 		struct Parameters
 		{
 			int ZP;
@@ -26,19 +45,65 @@ namespace SabreRecon {
 			std::vector<double> composition; //percent composition
 			double energy;
 			double thickness;
+			Coefficients coeffs; //must be (re)initialized with InitCoefficients whenever ZT or composition change
+		};
+	
+		/*
+			Range R(E) of one projectile in one target, with the stopping power at each node so that both R(E) and
+			its inverse can be interpolated with cubic Hermite polynomials using exact derivatives.
+			Energy loss through thickness t is then E - R^-1(R(E) - t), and reverse loss R^-1(R(E) + t) - E.
+		*/
+		struct RangeTable
+		{
+			int ZP = 0;
+			double massP = 0.0;
+			double logEnergyMin = 0.0;
+			double logEnergyStep = 0.0;
+			std::vector<double> energy; //MeV
+			std::vector<double> range; //ug/cm^2
+			std::vector<double> stopping; //keV/(ug/cm^2)
 		};
 	
+		enum class IntegrationStatus
+		{
+			Success,
+			Stopped, //forward only; particle stopped inside the material
+			MaxSteps, //step budget exhausted before reaching the full thickness
+			StepUnderflow //tolerance could not be met with a representable step
+		};
+
+		struct IntegrationResult
+		{
+			double energyLoss = 0.0; //MeV
+			IntegrationStatus status = IntegrationStatus::Success;
+			int steps = 0;
+			int rejectedSteps = 0;
+			int stoppingEvaluations = 0;
+		};
+
 		//Main integration functions
 		double GetEnergyLoss(const Parameters& params);
 		double GetReverseEnergyLoss(const Parameters& params);
+		//Adaptive Dormand-Prince 5(4) integration with diagnostics. tolerance is the relative error allowed per step
+		IntegrationResult IntegrateEnergyLoss(const Parameters& params, double tolerance = defaultTolerance);
+		IntegrationResult IntegrateReverseEnergyLoss(const Parameters& params, double tolerance = defaultTolerance);
+		const char* GetStatusString(IntegrationStatus status);
+
+		//Range table functions
+		bool BuildRangeTable(const Parameters& params, RangeTable& table);
+		double GetRange(const RangeTable& table, double energy);
+		double GetEnergyFromRange(const RangeTable& table, double range);
+		double GetEnergyLossFromRange(const RangeTable& table, double energy, double thickness);
+		double GetReverseEnergyLossFromRange(const RangeTable& table, double energy, double thickness);
 		
 		//Helpers
+		bool InitCoefficients(Parameters& params);
 		double GetTotalStoppingPower(const Parameters& params, double current_energy);
 		double GetElectronicStoppingPower(const Parameters& params, double current_energy);
 		double GetNuclearStoppingPower(const Parameters& params, double current_energy);
-		double Hydrogen_dEdx_Low(double ePerU, int z);
-		double Hydrogen_dEdx_Med(double ePerU, int z);
-		double Hydrogen_dEdx_High(double ePerU, double massP, double energy, int z);
+		double Hydrogen_dEdx_Low(double ePerU, const double* coeffs);
+		double Hydrogen_dEdx_Med(double ePerU, const double* coeffs);
+		double Hydrogen_dEdx_High(double ePerU, double massP, double energy, const double* coeffs);
 		double CalculateEffectiveChargeRatio(double ePerU, int zp, int z);
 
 	}
@@ -5,13 +5,19 @@ namespace SabreRecon {
 
 	namespace EnergyLoss {
 
-		static constexpr double maxFracStep = 0.001;
-		static constexpr int maxDepth = 50;
+		static constexpr int maxIntegrationSteps = 10000;
+		static constexpr double minStepFraction = 1.0e-12; //smallest step as a fraction of the thickness
+		static constexpr double stoppedFraction = 0.05; //particle considered stopped below this fraction of its initial energy
 		static constexpr double maxHEperU = 100000.0;
 		static constexpr double avogadro = 0.60221367; //N_A times 10^(-24) for converting
 		static constexpr double mev2u = 1.0/931.4940954;
 		static constexpr double HMass = 938.27231; //MeV, for beta calc
 
+		//Range table grid, log spaced in energy
+		static constexpr double rangeTableEnergyMin = 0.01; //MeV
+		static constexpr double rangeTableEnergyMax = 200.0; //MeV
+		static constexpr int rangeTablePoints = 1000;
+
 		#define MAX_Z 93 //Maximum number of elements for which we have hydrogen coefficients
 	
 		/*Atomic Masses for elements H through U. Taken from ELAST data*/
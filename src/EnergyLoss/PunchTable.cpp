@@ -1,16 +1,17 @@
 #include "PunchTable.h"
 #include <fstream>
 #include <iostream>
+#include <algorithm>
 
 namespace PunchTable {
 
 	PunchTable::PunchTable() :
-		m_validFlag(false)
+		m_interpolateTheta(false), m_uniformTheta(false), m_validFlag(false)
 	{
 	}
 
 	PunchTable::PunchTable(const std::string& filename) :
-		m_validFlag(false)
+		m_interpolateTheta(false), m_uniformTheta(false), m_validFlag(false)
 	{
 		ReadFile(filename);
 	}
@@ -19,6 +20,13 @@ namespace PunchTable {
 
 	void PunchTable::ReadFile(const std::string& filename)
 	{
+		m_surface = SplineSurface(); //rebuilt from the new splines if interpolating
+		if(TableFile::IsTableFile(filename))
+		{
+			ReadBinaryFile(filename);
+			return;
+		}
+
 		std::ifstream input(filename);
 		if(!input.is_open())
 		{
@@ -32,18 +40,9 @@ namespace PunchTable {
 		double theta;
 		double value;
 		std::vector<double> energyIn, energyDep;
+		std::vector<double> rowTheta;
 
-		input>>junk>>junk>>m_projectileString;
-		input>>junk>>junk;
-
-		while(input>>junk)
-		{
-			if(junk == "---------------------------------")
-				break;
-			input>>junk;
-			m_materialString += junk;
-			input>>junk;
-		}
+		TableFile::ReadTextHeader(input, m_projectileString, m_materialString);
 		
 		input>>junk>>m_thetaMin>>junk>>m_thetaMax>>junk>>m_thetaStep;
 		std::getline(input, junk);
@@ -57,6 +56,7 @@ namespace PunchTable {
 				energyIn.clear();
 				energyDep.clear();
 				input>>theta;
+				rowTheta.push_back(theta);
 				while(input>>junk)
 				{
 					if(junk == "end_theta")
@@ -79,8 +79,79 @@ namespace PunchTable {
 			}
 		}
 
+		if(m_splines.empty())
+		{
+			std::cerr<<"Punch table "<<filename<<" has no theta bins!"<<std::endl;
+			m_validFlag = false;
+			return;
+		}
+
+		m_uniformTheta = TableFile::IsUniformThetaGrid(rowTheta, m_thetaMin, m_thetaStep);
+		if(!m_uniformTheta)
+			std::cerr<<"WARN -- Punch table "<<filename<<" theta bins are not uniform from "<<m_thetaMin<<" in steps of "<<m_thetaStep
+					 <<"; theta interpolation is unavailable"<<std::endl;
+
 		m_validFlag = true;
+		if(m_interpolateTheta)
+			BuildSurface();
+
+	}
+
+	/*Binary tables carry solved splines; the splines point straight into the mapped file*/
+	void PunchTable::ReadBinaryFile(const std::string& filename)
+	{
+		m_splines.clear();
+		m_tableFile = std::make_shared<TableFile>();
+		if(!m_tableFile->Open(filename, TableType::Punch))
+		{
+			m_validFlag = false;
+			return;
+		}
+
+		const TableFileHeader& header = m_tableFile->GetHeader();
+		m_projectileString = m_tableFile->GetProjectile();
+		m_materialString = m_tableFile->GetMaterial();
+		m_thetaMin = header.thetaMin;
+		m_thetaMax = header.thetaMax;
+		m_thetaStep = header.thetaStep;
+		m_splines.resize(header.nThetaBins);
+		for(uint64_t i=0; i<header.nThetaBins; i++)
+			m_tableFile->SetSpline(i, m_splines[i]);
+
+		m_uniformTheta = true;
+
+		m_validFlag = true;
+		if(m_interpolateTheta)
+			BuildSurface();
+	}
+
+	/*The surface resamples every theta bin, so it is only built for tables that interpolate in theta*/
+	void PunchTable::SetInterpolateTheta(bool interpolate)
+	{
+		m_interpolateTheta = interpolate;
+		if(m_interpolateTheta && m_validFlag)
+			BuildSurface();
+	}
 
+	void PunchTable::BuildSurface()
+	{
+		if(m_uniformTheta && !m_surface.IsValid())
+			m_surface.Build(m_thetaMin, m_thetaStep, m_splines);
+	}
+
+	bool PunchTable::WriteBinaryFile(const std::string& filename) const
+	{
+		if(!m_validFlag)
+		{
+			std::cerr<<"PunchTable not initialized at WriteBinaryFile()"<<std::endl;
+			return false;
+		}
+		else if(!m_uniformTheta)
+		{
+			std::cerr<<"PunchTable with non-uniform theta bins cannot be written to a binary file"<<std::endl;
+			return false;
+		}
+		return TableFile::Write(filename, TableType::Punch, m_projectileString, m_materialString, m_thetaMin, m_thetaMax, m_thetaStep, m_splines);
 	}
 
 	double PunchTable::GetInitialKineticEnergy(double theta_incident, double e_deposited)
@@ -97,7 +168,14 @@ namespace PunchTable {
 			return 0.0;
 		}
 
-		int theta_bin = (theta_incident - m_thetaMin)/m_thetaStep;
+		if(m_interpolateTheta && m_surface.IsValid())
+		{
+			double initialE = m_surface.Evaluate(theta_incident, e_deposited);
+			return initialE == 0.0 ? e_deposited : initialE; //Not in the surface, stopped completely
+		}
+
+		//Clamped in floating point first, so a theta at the edge of the grid (or NaN) cannot index past the splines
+		int theta_bin = std::max(0.0, std::min((theta_incident - m_thetaMin)/m_thetaStep, double(m_splines.size() - 1)));
 
 		//std::cout<<"theta bin: "<<theta_bin<<" theta_inc: "<<theta_incident<<std::endl;
 
@@ -116,4 +194,38 @@ namespace PunchTable {
 			return e_deposited;
 	}
 
+	/*Theta is converted to degrees a chunk at a time so that the surface can be evaluated in blocks*/
+	void PunchTable::GetInitialKineticEnergy(const double* theta_incident, const double* e_deposited, double* initialE, std::size_t n)
+	{
+		if(!m_validFlag)
+		{
+			std::cerr<<"PunchTable not initialized at GetInitialKineticEnergy()"<<std::endl;
+			std::fill(initialE, initialE + n, 0.0);
+			return;
+		}
+		else if(!m_interpolateTheta || !m_surface.IsValid())
+		{
+			for(std::size_t i=0; i<n; i++)
+				initialE[i] = GetInitialKineticEnergy(theta_incident[i], e_deposited[i]);
+			return;
+		}
+
+		double thetaDeg[s_batchChunk];
+		std::size_t count;
+		for(std::size_t start=0; start<n; start += s_batchChunk)
+		{
+			count = std::min(s_batchChunk, n - start);
+			for(std::size_t i=0; i<count; i++)
+				thetaDeg[i] = theta_incident[start+i]/s_deg2rad;
+			m_surface.Evaluate(thetaDeg, e_deposited + start, initialE + start, count);
+			for(std::size_t i=0; i<count; i++)
+			{
+				if(thetaDeg[i] < m_thetaMin || thetaDeg[i] > m_thetaMax)
+					initialE[start+i] = 0.0;
+				else if(initialE[start+i] == 0.0) //Not in the surface, stopped completely
+					initialE[start+i] = e_deposited[start+i];
+			}
+		}
+	}
+
 }
\ No newline at end of file
@@ -2,9 +2,12 @@
 #define PUNCHTABLE_H
 
 #include "CubicSpline.h"
+#include "TableFile.h"
+#include "SplineSurface.h"
 #include <vector>
 #include <string>
 #include <cmath>
+#include <memory>
 
 namespace PunchTable {
 
@@ -14,22 +17,38 @@ namespace PunchTable {
 		PunchTable(const std::string& filename);
 		~PunchTable();
 
-		void ReadFile(const std::string& filename);
+		void ReadFile(const std::string& filename); //text or binary, detected from the file
+		bool WriteBinaryFile(const std::string& filename) const;
 		std::string GetProjectile() { return m_projectileString; }
         std::string GetMaterial() { return m_materialString; }
 
 		double GetInitialKineticEnergy(double theta_incident, double e_deposited); //radians, MeV
+		//Batch version over n (theta, energy) pairs. Same conventions as the single value call.
+		void GetInitialKineticEnergy(const double* theta_incident, const double* e_deposited, double* initialE, std::size_t n);
 		inline bool IsValid() const { return m_validFlag; }
+		/*
+			Interpolate smoothly across theta bins instead of using the spline of the bin containing theta (the default). Where
+			only one of the bracketing bins covers the energy, that bin's spline is used.
+		*/
+		void SetInterpolateTheta(bool interpolate); //builds the surface the first time interpolation is enabled
 
 	private:
+		void ReadBinaryFile(const std::string& filename);
+		void BuildSurface();
+
 		std::string m_projectileString;
         std::string m_materialString;
 		std::vector<CubicSpline> m_splines;
 		double m_thetaStep, m_thetaMin, m_thetaMax;
+		SplineSurface m_surface;
+		bool m_interpolateTheta;
+		bool m_uniformTheta; //theta bins at m_thetaMin + i*m_thetaStep; required for the surface and binary files
+		std::shared_ptr<TableFile> m_tableFile; //owns the mapped spline segments when read from a binary file
 
 		bool m_validFlag;
 
 		static constexpr double s_deg2rad = M_PI/180.0;
+		static constexpr std::size_t s_batchChunk = 256;
 	};
 
 }
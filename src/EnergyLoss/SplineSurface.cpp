@@ -0,0 +1,269 @@
+#include "SplineSurface.h"
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#ifdef SPLINE_SURFACE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace PunchTable {
+
+	/*
+		Value and derivative of a spline segment's cubic. Not limited to the segment, so that grid nodes just past the end
+		of a row continue the edge cubic.
+	*/
+	static void EvaluateSegment(const Spline& s, double x, double& value, double& derivative)
+	{
+		double h = s.x2 - s.x1;
+		double t = (x - s.x1)/h;
+		double a = s.k1*h - (s.y2 - s.y1);
+		double b = -s.k2*h + (s.y2 - s.y1);
+		value = (1.0-t)*s.y1 + t*s.y2 + t*(1.0-t)*((1.0-t)*a + t*b);
+		derivative = ((s.y2 - s.y1) + (1.0-2.0*t)*((1.0-t)*a + t*b) + t*(1.0-t)*(b - a))/h;
+	}
+
+	SplineSurface::SplineSurface() :
+		m_nTheta(0), m_nX(0), m_thetaMin(0.0), m_invThetaStep(0.0), m_xMin(0.0), m_xStep(0.0), m_invXStep(0.0), m_validFlag(false)
+	{
+	}
+
+	SplineSurface::~SplineSurface() {}
+
+	/*
+		The x grid spans all rows with the smallest knot spacing found in any row (capped at s_maxPoints), so rows generated
+		on a common uniform energy grid are reproduced exactly.
+	*/
+	void SplineSurface::Build(double thetaMin, double thetaStep, const std::vector<CubicSpline>& rows)
+	{
+		m_validFlag = false;
+		m_nTheta = rows.size();
+		m_thetaMin = thetaMin;
+		m_invThetaStep = thetaStep > 0.0 ? 1.0/thetaStep : 0.0;
+		m_rowMin.assign(m_nTheta, std::numeric_limits<double>::infinity());
+		m_rowMax.assign(m_nTheta, -std::numeric_limits<double>::infinity());
+
+		double xMin = std::numeric_limits<double>::infinity();
+		double xMax = -std::numeric_limits<double>::infinity();
+		double step = std::numeric_limits<double>::infinity();
+		for(int r=0; r<m_nTheta; r++)
+		{
+			if(!rows[r].IsValid())
+				continue;
+			const Spline* splines = rows[r].GetSplineData();
+			std::size_t nSplines = rows[r].GetNumberOfSplines();
+			m_rowMin[r] = splines[0].x1;
+			m_rowMax[r] = splines[nSplines-1].x2;
+			xMin = std::min(xMin, m_rowMin[r]);
+			xMax = std::max(xMax, m_rowMax[r]);
+			for(std::size_t i=0; i<nSplines; i++)
+				step = std::min(step, splines[i].x2 - splines[i].x1);
+		}
+
+		if(m_nTheta == 0 || !(xMax > xMin) || !(step > 0.0) || m_invThetaStep == 0.0)
+		{
+			std::cerr<<"Error at SplineSurface::Build! No valid rows to build a surface from."<<std::endl;
+			return;
+		}
+
+		m_nX = std::min(int(std::ceil((xMax - xMin)/step - 1.0e-6)) + 1, s_maxPoints);
+		m_nX = std::max(m_nX, 2);
+		m_xMin = xMin;
+		m_xStep = (xMax - xMin)/(m_nX - 1);
+		m_invXStep = 1.0/m_xStep;
+
+		m_values.assign(m_nTheta*m_nX, 0.0);
+		m_slopes.assign(m_nTheta*m_nX, 0.0);
+		double x, value, derivative;
+		for(int r=0; r<m_nTheta; r++)
+		{
+			if(!rows[r].IsValid())
+				continue;
+			const Spline* splines = rows[r].GetSplineData();
+			int last = rows[r].GetNumberOfSplines() - 1;
+			int segment = 0;
+			for(int i=0; i<m_nX; i++)
+			{
+				x = m_xMin + i*m_xStep;
+				while(segment < last && x > splines[segment].x2)
+					segment++;
+				EvaluateSegment(splines[segment], x, value, derivative);
+				m_values[r*m_nX + i] = value;
+				m_slopes[r*m_nX + i] = derivative*m_xStep;
+			}
+		}
+
+		m_validFlag = true;
+	}
+
+	//basis holds the Hermite basis functions at the position within the cell
+	double SplineSurface::EvaluateRow(int row, int cell, const double* basis) const
+	{
+		int index = row*m_nX + cell;
+		return basis[0]*m_values[index] + basis[1]*m_slopes[index] + basis[2]*m_values[index+1] + basis[3]*m_slopes[index+1];
+	}
+
+	/*
+		theta outside of the rows is clamped to the first/last row (the table decides the valid theta range). Across theta
+		the slopes are central differences where the outer neighbors contain x, one sided otherwise. Where only one of the
+		bracketing rows contains x (the ends of the rows) that row is used alone, so the coverage is never smaller than the
+		per-bin lookup's.
+	*/
+	double SplineSurface::Evaluate(double theta, double x) const
+	{
+		if(!m_validFlag)
+			return 0.0;
+
+		double xIndex = (x - m_xMin)*m_invXStep;
+		if(!(xIndex >= 0.0 && xIndex <= m_nX - 1))
+			return 0.0;
+		int cell = std::min(int(xIndex), m_nX - 2);
+		double t = xIndex - cell;
+		double t2 = t*t;
+		double t3 = t2*t;
+		const double basis[4] = { 2.0*t3 - 3.0*t2 + 1.0, t3 - 2.0*t2 + t, 3.0*t2 - 2.0*t3, t3 - t2 };
+
+		double thetaIndex = std::max(0.0, std::min((theta - m_thetaMin)*m_invThetaStep, double(m_nTheta - 1)));
+		int row = std::min(int(thetaIndex), std::max(m_nTheta - 2, 0));
+		double s = thetaIndex - row;
+
+		bool inRow = RowContains(row, x);
+		bool inNext = m_nTheta > 1 && RowContains(row+1, x);
+		if(!inRow && !inNext)
+			return 0.0;
+		else if(!inNext || (inRow && s == 0.0))
+			return EvaluateRow(row, cell, basis);
+		else if(!inRow || s == 1.0)
+			return EvaluateRow(row+1, cell, basis);
+
+		double f0 = EvaluateRow(row, cell, basis);
+		double f1 = EvaluateRow(row+1, cell, basis);
+
+		double m0 = (row > 0 && RowContains(row-1, x)) ? 0.5*(f1 - EvaluateRow(row-1, cell, basis)) : f1 - f0;
+		double m1 = (row+2 < m_nTheta && RowContains(row+2, x)) ? 0.5*(EvaluateRow(row+2, cell, basis) - f0) : f1 - f0;
+		double s2 = s*s;
+		double s3 = s2*s;
+		return (2.0*s3 - 3.0*s2 + 1.0)*f0 + (s3 - 2.0*s2 + s)*m0 + (3.0*s2 - 2.0*s3)*f1 + (s3 - s2)*m1;
+	}
+
+	void SplineSurface::Evaluate(const double* theta, const double* x, double* result, std::size_t n) const
+	{
+		if(!m_validFlag)
+		{
+			std::fill(result, result + n, 0.0);
+			return;
+		}
+
+		std::size_t i = 0;
+#ifdef SPLINE_SURFACE_AVX2
+		if(m_nTheta > 1 && HasAVX2())
+		{
+			for(; i+4 <= n; i += 4)
+				EvaluateBlockAVX2(theta + i, x + i, result + i);
+		}
+#endif
+		for(; i<n; i++)
+			result[i] = Evaluate(theta[i], x[i]);
+	}
+
+#ifdef SPLINE_SURFACE_AVX2
+	//The AVX2 path is compiled in by SABRERECON_AVX2 but only taken on CPUs that support it
+	bool SplineSurface::HasAVX2()
+	{
+		static const bool hasAVX2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+		return hasAVX2;
+	}
+
+	//Gathers with an explicit zero source, as the plain gather leaves the source register formally uninitialized
+	__attribute__((target("avx2,fma"))) static inline __m256d Gather(const double* base, __m128i index)
+	{
+		return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, index, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+	}
+
+	/*
+		Four lanes of Evaluate. The common case (x on the grid and inside both bracketing rows) is done with gathers. Indices
+		are clamped so every lane can be gathered; lanes that need one of the edge cases are redone with the scalar path.
+	*/
+	__attribute__((target("avx2,fma"))) void SplineSurface::EvaluateBlockAVX2(const double* theta, const double* x, double* result) const
+	{
+		const __m256d zero = _mm256_setzero_pd();
+		const __m256d half = _mm256_set1_pd(0.5);
+		const __m256d one = _mm256_set1_pd(1.0);
+		const __m256d two = _mm256_set1_pd(2.0);
+		const __m256d three = _mm256_set1_pd(3.0);
+
+		__m256d xv = _mm256_loadu_pd(x);
+		__m256d xIndex = _mm256_mul_pd(_mm256_sub_pd(xv, _mm256_set1_pd(m_xMin)), _mm256_set1_pd(m_invXStep));
+		__m256d inGrid = _mm256_and_pd(_mm256_cmp_pd(xIndex, zero, _CMP_GE_OQ), _mm256_cmp_pd(xIndex, _mm256_set1_pd(m_nX - 1), _CMP_LE_OQ));
+		xIndex = _mm256_and_pd(xIndex, inGrid); //keep gather indices in range for lanes that fall back
+		__m256d cellD = _mm256_min_pd(_mm256_floor_pd(xIndex), _mm256_set1_pd(m_nX - 2));
+		__m256d t = _mm256_sub_pd(xIndex, cellD);
+
+		__m256d thetaIndex = _mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(theta), _mm256_set1_pd(m_thetaMin)), _mm256_set1_pd(m_invThetaStep));
+		thetaIndex = _mm256_max_pd(_mm256_min_pd(thetaIndex, _mm256_set1_pd(m_nTheta - 1)), zero);
+		__m256d rowD = _mm256_min_pd(_mm256_floor_pd(thetaIndex), _mm256_set1_pd(m_nTheta - 2));
+		__m256d s = _mm256_sub_pd(thetaIndex, rowD);
+
+		__m128i cell = _mm256_cvtpd_epi32(cellD);
+		__m128i row = _mm256_cvtpd_epi32(rowD);
+		__m128i rowM = _mm_max_epi32(_mm_sub_epi32(row, _mm_set1_epi32(1)), _mm_setzero_si128());
+		__m128i rowP1 = _mm_add_epi32(row, _mm_set1_epi32(1));
+		__m128i rowP2 = _mm_min_epi32(_mm_add_epi32(row, _mm_set1_epi32(2)), _mm_set1_epi32(m_nTheta - 1));
+
+		auto contains = [&](__m128i r) __attribute__((target("avx2,fma")))
+		{
+			__m256d low = Gather(m_rowMin.data(), r);
+			__m256d high = Gather(m_rowMax.data(), r);
+			return _mm256_and_pd(_mm256_cmp_pd(xv, low, _CMP_GE_OQ), _mm256_cmp_pd(xv, high, _CMP_LE_OQ));
+		};
+
+		int fast = _mm256_movemask_pd(_mm256_and_pd(inGrid, _mm256_and_pd(contains(row), contains(rowP1))));
+		if(fast == 0)
+		{
+			for(int i=0; i<4; i++)
+				result[i] = Evaluate(theta[i], x[i]);
+			return;
+		}
+
+		__m256d t2 = _mm256_mul_pd(t, t);
+		__m256d t3 = _mm256_mul_pd(t2, t);
+		__m256d b0 = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(two, t3), _mm256_mul_pd(three, t2)), one);
+		__m256d b1 = _mm256_add_pd(_mm256_sub_pd(t3, _mm256_mul_pd(two, t2)), t);
+		__m256d b2 = _mm256_sub_pd(_mm256_mul_pd(three, t2), _mm256_mul_pd(two, t3));
+		__m256d b3 = _mm256_sub_pd(t3, t2);
+		__m128i nX = _mm_set1_epi32(m_nX);
+		auto evaluateRow = [&](__m128i r) __attribute__((target("avx2,fma")))
+		{
+			__m128i index = _mm_add_epi32(_mm_mullo_epi32(r, nX), cell);
+			__m128i indexNext = _mm_add_epi32(index, _mm_set1_epi32(1));
+			__m256d value = _mm256_mul_pd(b0, Gather(m_values.data(), index));
+			value = _mm256_add_pd(value, _mm256_mul_pd(b1, Gather(m_slopes.data(), index)));
+			value = _mm256_add_pd(value, _mm256_mul_pd(b2, Gather(m_values.data(), indexNext)));
+			return _mm256_add_pd(value, _mm256_mul_pd(b3, Gather(m_slopes.data(), indexNext)));
+		};
+
+		__m256d f0 = evaluateRow(row);
+		__m256d f1 = evaluateRow(rowP1);
+		__m256d oneSided = _mm256_sub_pd(f1, f0);
+		__m256d hasM = _mm256_and_pd(_mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmpgt_epi32(row, _mm_setzero_si128()))), contains(rowM));
+		__m256d hasP = _mm256_and_pd(_mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_cmplt_epi32(rowP1, _mm_set1_epi32(m_nTheta - 1)))), contains(rowP2));
+		__m256d m0 = _mm256_blendv_pd(oneSided, _mm256_mul_pd(half, _mm256_sub_pd(f1, evaluateRow(rowM))), hasM);
+		__m256d m1 = _mm256_blendv_pd(oneSided, _mm256_mul_pd(half, _mm256_sub_pd(evaluateRow(rowP2), f0)), hasP);
+
+		__m256d s2 = _mm256_mul_pd(s, s);
+		__m256d s3 = _mm256_mul_pd(s2, s);
+		__m256d value = _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(two, s3), _mm256_mul_pd(three, s2)), one), f0);
+		value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(s3, _mm256_mul_pd(two, s2)), s), m0));
+		value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_sub_pd(_mm256_mul_pd(three, s2), _mm256_mul_pd(two, s3)), f1));
+		value = _mm256_add_pd(value, _mm256_mul_pd(_mm256_sub_pd(s3, s2), m1));
+		_mm256_storeu_pd(result, value);
+
+		for(int i=0; i<4; i++)
+		{
+			if(!(fast & (1<<i)))
+				result[i] = Evaluate(theta[i], x[i]);
+		}
+	}
+#endif
+
+}
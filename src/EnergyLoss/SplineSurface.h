@@ -0,0 +1,59 @@
+/*
+SplineSurface.h
+Smooth 2D interpolation over the theta bins of a PunchTable or ElossTable. Each theta row's 1D spline is sampled on a
+common uniform grid (value and slope at each node), stored contiguously as separate value/slope arrays. Evaluation is
+cubic Hermite along x within a row and cubic Hermite (Catmull-Rom slopes) across theta, so there are no jumps at the
+theta bin edges and the x axis reproduces the row splines exactly when their knots sit on the grid.
+*/
+#ifndef SPLINE_SURFACE_H
+#define SPLINE_SURFACE_H
+
+#include "CubicSpline.h"
+#include <vector>
+#include <cstddef>
+
+//The AVX2 batch path needs GCC/Clang on x86; it is chosen at run time, so the build still runs on CPUs without AVX2
+#if defined(SABRERECON_AVX2) && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SPLINE_SURFACE_AVX2
+#endif
+
+namespace PunchTable {
+
+	class SplineSurface
+	{
+	public:
+		SplineSurface();
+		~SplineSurface();
+
+		//Rows are the splines at theta = thetaMin + i*thetaStep. Invalid rows are treated as empty.
+		void Build(double thetaMin, double thetaStep, const std::vector<CubicSpline>& rows);
+		//Returns 0 if x is outside of both rows bracketing theta (same convention as CubicSpline::Evaluate)
+		double Evaluate(double theta, double x) const;
+		//Batch version filling result[i] for each (theta[i], x[i]). Uses AVX2 when built with it and the CPU supports it.
+		void Evaluate(const double* theta, const double* x, double* result, std::size_t n) const;
+		inline bool IsValid() const { return m_validFlag; }
+
+	private:
+		inline bool RowContains(int row, double x) const { return x >= m_rowMin[row] && x <= m_rowMax[row]; }
+		double EvaluateRow(int row, int cell, const double* basis) const;
+#ifdef SPLINE_SURFACE_AVX2
+		static bool HasAVX2();
+		void EvaluateBlockAVX2(const double* theta, const double* x, double* result) const;
+#endif
+
+		int m_nTheta;
+		int m_nX;
+		double m_thetaMin, m_invThetaStep;
+		double m_xMin, m_xStep, m_invXStep;
+		std::vector<double> m_values; //theta major, m_nX per row
+		std::vector<double> m_slopes; //dy/dx scaled by the grid step
+		std::vector<double> m_rowMin, m_rowMax;
+
+		bool m_validFlag;
+
+		static constexpr int s_maxPoints = 4096; //per row; coarsens the grid for very finely spaced knots
+	};
+
+}
+
+#endif
@@ -0,0 +1,256 @@
+#include "TableFile.h"
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <cmath>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace PunchTable {
+
+	static_assert(sizeof(TableFileHeader)%sizeof(double) == 0, "TableFileHeader must keep the segments 8 byte aligned");
+
+	constexpr char TableFile::s_magic[8];
+
+	TableFile::TableFile() :
+		m_data(nullptr), m_size(0), m_header(nullptr), m_offsets(nullptr), m_segments(nullptr), m_validFlag(false)
+	{
+	}
+
+	TableFile::~TableFile()
+	{
+		Close();
+	}
+
+	void TableFile::Close()
+	{
+		if(m_data != nullptr)
+			munmap(m_data, m_size);
+		m_data = nullptr;
+		m_size = 0;
+		m_header = nullptr;
+		m_offsets = nullptr;
+		m_segments = nullptr;
+		m_validFlag = false;
+	}
+
+	/*Map the file and check that the header, theta grid, offsets and segment count are consistent with each other and the file size*/
+	bool TableFile::Open(const std::string& filename, TableType type)
+	{
+		Close();
+
+		int fd = open(filename.c_str(), O_RDONLY);
+		if(fd == -1)
+		{
+			std::cerr<<"Unable to open table file named "<<filename<<"!"<<std::endl;
+			return false;
+		}
+
+		struct stat info;
+		if(fstat(fd, &info) == -1 || uint64_t(info.st_size) < sizeof(TableFileHeader))
+		{
+			std::cerr<<"Binary table file "<<filename<<" is too small to hold a header!"<<std::endl;
+			close(fd);
+			return false;
+		}
+
+		m_size = info.st_size;
+		m_data = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if(m_data == MAP_FAILED)
+		{
+			std::cerr<<"Unable to map binary table file "<<filename<<"!"<<std::endl;
+			m_data = nullptr;
+			m_size = 0;
+			return false;
+		}
+
+		m_header = static_cast<const TableFileHeader*>(m_data);
+		if(std::memcmp(m_header->magic, s_magic, sizeof(s_magic)) != 0 || m_header->version != s_version || m_header->type != type)
+		{
+			std::cerr<<"Binary table file "<<filename<<" has the wrong format, version, or table type!"<<std::endl;
+			Close();
+			return false;
+		}
+
+		if(!IsValidThetaGrid(m_header->thetaMin, m_header->thetaMax, m_header->thetaStep, m_header->nThetaBins))
+		{
+			std::cerr<<"Binary table file "<<filename<<" has an invalid theta grid!"<<std::endl;
+			Close();
+			return false;
+		}
+
+		//Bound the counts by the file size before multiplying, so a corrupt header cannot wrap the size checks
+		uint64_t bodySize = m_size - sizeof(TableFileHeader);
+		if(bodySize < sizeof(uint64_t) || m_header->nThetaBins > bodySize/sizeof(uint64_t) - 1)
+		{
+			std::cerr<<"Binary table file "<<filename<<" is truncated!"<<std::endl;
+			Close();
+			return false;
+		}
+		uint64_t offsetsSize = (m_header->nThetaBins + 1)*sizeof(uint64_t);
+		uint64_t maxSegments = (bodySize - offsetsSize)/sizeof(Spline);
+
+		const char* bytes = static_cast<const char*>(m_data);
+		m_offsets = reinterpret_cast<const uint64_t*>(bytes + sizeof(TableFileHeader));
+		m_segments = reinterpret_cast<const Spline*>(bytes + sizeof(TableFileHeader) + offsetsSize);
+		for(uint64_t i=0; i<m_header->nThetaBins; i++)
+		{
+			if(m_offsets[i] > m_offsets[i+1] || m_offsets[i+1] > maxSegments)
+			{
+				std::cerr<<"Binary table file "<<filename<<" has corrupted theta bin offsets!"<<std::endl;
+				Close();
+				return false;
+			}
+		}
+		if(m_offsets[0] != 0 || m_offsets[m_header->nThetaBins] > maxSegments
+		   || m_size != sizeof(TableFileHeader) + offsetsSize + m_offsets[m_header->nThetaBins]*sizeof(Spline))
+		{
+			std::cerr<<"Binary table file "<<filename<<" size does not match its header!"<<std::endl;
+			Close();
+			return false;
+		}
+
+		m_validFlag = true;
+		return true;
+	}
+
+	std::string TableFile::GetProjectile() const
+	{
+		return std::string(m_header->projectile, strnlen(m_header->projectile, sizeof(m_header->projectile)));
+	}
+
+	std::string TableFile::GetMaterial() const
+	{
+		return std::string(m_header->material, strnlen(m_header->material, sizeof(m_header->material)));
+	}
+
+	void TableFile::SetSpline(uint64_t thetaBin, CubicSpline& spline) const
+	{
+		spline.SetSplines(m_segments + m_offsets[thetaBin], m_offsets[thetaBin+1] - m_offsets[thetaBin]);
+	}
+
+	bool TableFile::IsTableFile(const std::string& filename)
+	{
+		std::ifstream input(filename, std::ios::binary);
+		char magic[sizeof(s_magic)];
+		if(!input.read(magic, sizeof(magic)))
+			return false;
+		return std::memcmp(magic, s_magic, sizeof(s_magic)) == 0;
+	}
+
+	bool TableFile::ReadHeader(const std::string& filename, TableType type, std::string& projectile, std::string& material)
+	{
+		projectile.clear();
+		material.clear();
+		if(IsTableFile(filename))
+		{
+			TableFile file;
+			if(!file.Open(filename, type))
+				return false;
+			projectile = file.GetProjectile();
+			material = file.GetMaterial();
+			return true;
+		}
+
+		std::ifstream input(filename);
+		if(!input.is_open())
+		{
+			std::cerr<<"Unable to open table file named "<<filename<<"!"<<std::endl;
+			return false;
+		}
+		ReadTextHeader(input, projectile, material);
+		return !projectile.empty();
+	}
+
+	void TableFile::ReadTextHeader(std::istream& input, std::string& projectile, std::string& material)
+	{
+		std::string junk;
+		input>>junk>>junk>>projectile;
+		input>>junk>>junk;
+
+		while(input>>junk)
+		{
+			if(junk == "---------------------------------")
+				break;
+			input>>junk;
+			material += junk;
+			input>>junk;
+		}
+	}
+
+	bool TableFile::IsUniformThetaGrid(const std::vector<double>& rowTheta, double thetaMin, double thetaStep)
+	{
+		if(!(thetaStep > 0.0))
+			return false;
+		for(std::size_t i=0; i<rowTheta.size(); i++)
+		{
+			if(!(std::fabs(rowTheta[i] - (thetaMin + i*thetaStep)) <= s_thetaGridTolerance*thetaStep))
+				return false;
+		}
+		return true;
+	}
+
+	/*The theta bin index is (theta - thetaMin)/thetaStep for any theta up to thetaMax, so every such index must be a bin*/
+	bool TableFile::IsValidThetaGrid(double thetaMin, double thetaMax, double thetaStep, uint64_t nThetaBins)
+	{
+		return std::isfinite(thetaMin) && std::isfinite(thetaMax) && std::isfinite(thetaStep) && thetaStep > 0.0 && thetaMax >= thetaMin
+			   && nThetaBins > 0 && std::floor((thetaMax - thetaMin)/thetaStep) < double(nThetaBins);
+	}
+
+	bool TableFile::Write(const std::string& filename, TableType type, const std::string& projectile, const std::string& material,
+						  double thetaMin, double thetaMax, double thetaStep, const std::vector<CubicSpline>& splines)
+	{
+		TableFileHeader header;
+		std::memset(&header, 0, sizeof(header));
+		if(!IsValidThetaGrid(thetaMin, thetaMax, thetaStep, splines.size()))
+		{
+			std::cerr<<"Theta range "<<thetaMin<<" to "<<thetaMax<<" in steps of "<<thetaStep<<" does not fit the "<<splines.size()
+					 <<" theta bins of binary table file "<<filename<<"!"<<std::endl;
+			return false;
+		}
+		if(projectile.size() >= sizeof(header.projectile) || material.size() >= sizeof(header.material))
+		{
+			std::cerr<<"Projectile or material name too long for binary table file "<<filename<<"!"<<std::endl;
+			return false;
+		}
+		std::memcpy(header.magic, s_magic, sizeof(s_magic));
+		header.version = s_version;
+		header.type = type;
+		header.nThetaBins = splines.size();
+		header.thetaMin = thetaMin;
+		header.thetaMax = thetaMax;
+		header.thetaStep = thetaStep;
+		std::memcpy(header.projectile, projectile.c_str(), projectile.size());
+		std::memcpy(header.material, material.c_str(), material.size());
+
+		std::vector<uint64_t> offsets(splines.size() + 1, 0);
+		for(size_t i=0; i<splines.size(); i++)
+			offsets[i+1] = offsets[i] + (splines[i].IsValid() ? splines[i].GetNumberOfSplines() : 0);
+
+		std::ofstream output(filename, std::ios::binary);
+		if(!output.is_open())
+		{
+			std::cerr<<"Unable to open binary table file "<<filename<<" for writing!"<<std::endl;
+			return false;
+		}
+
+		output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		output.write(reinterpret_cast<const char*>(offsets.data()), offsets.size()*sizeof(uint64_t));
+		for(auto& spline : splines)
+		{
+			if(spline.IsValid())
+				output.write(reinterpret_cast<const char*>(spline.GetSplineData()), spline.GetNumberOfSplines()*sizeof(Spline));
+		}
+
+		if(!output)
+		{
+			std::cerr<<"Error writing binary table file "<<filename<<"!"<<std::endl;
+			return false;
+		}
+		return true;
+	}
+
+}
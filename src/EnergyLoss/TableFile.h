@@ -0,0 +1,91 @@
+/*
+TableFile.h
+Binary format for PunchTables and ElossTables. The file holds the table header, the theta grid and the already solved
+spline segments for every theta bin, so a table can be used straight out of a read-only memory map without any parsing
+or spline building. Pages are shared between processes reading the same file.
+
+Layout (native endianness, everything 8 byte aligned):
+	TableFileHeader
+	uint64_t offsets[nThetaBins+1] -- first segment of each theta bin; bins with no segments are invalid splines
+	Spline segments[offsets[nThetaBins]]
+
+Theta bins sit at thetaMin + i*thetaStep; text tables with any other theta grid are not converted. Text tables are
+converted with the ConvertTables executable.
+*/
+#ifndef TABLE_FILE_H
+#define TABLE_FILE_H
+
+#include "CubicSpline.h"
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <istream>
+
+namespace PunchTable {
+
+	enum class TableType : uint32_t
+	{
+		Punch = 1,
+		Eloss = 2
+	};
+
+	struct TableFileHeader
+	{
+		char magic[8];
+		uint32_t version;
+		TableType type;
+		uint64_t nThetaBins;
+		double thetaMin, thetaMax, thetaStep; //deg
+		char projectile[64];
+		char material[128];
+	};
+
+	/*Read-only memory map of a binary table file. Unmapped when destroyed, so keep it alive as long as its splines are used*/
+	class TableFile
+	{
+	public:
+		TableFile();
+		~TableFile();
+		TableFile(const TableFile&) = delete;
+		TableFile& operator=(const TableFile&) = delete;
+
+		bool Open(const std::string& filename, TableType type);
+		inline bool IsValid() const { return m_validFlag; }
+
+		inline const TableFileHeader& GetHeader() const { return *m_header; }
+		std::string GetProjectile() const;
+		std::string GetMaterial() const;
+		//Sets the spline for a theta bin to point at the mapped segments
+		void SetSpline(uint64_t thetaBin, CubicSpline& spline) const;
+
+		static bool IsTableFile(const std::string& filename);
+		//Reads only the projectile and material of a text or binary table, without loading it
+		static bool ReadHeader(const std::string& filename, TableType type, std::string& projectile, std::string& material);
+		//Projectile and material lines at the top of a text table; leaves the stream at the theta range line
+		static void ReadTextHeader(std::istream& input, std::string& projectile, std::string& material);
+		//Whether the begin_theta values of a text table sit at thetaMin + i*thetaStep, as the theta bin index assumes
+		static bool IsUniformThetaGrid(const std::vector<double>& rowTheta, double thetaMin, double thetaStep);
+		//Finite grid with a positive step whose bin index stays below nThetaBins for every theta up to thetaMax
+		static bool IsValidThetaGrid(double thetaMin, double thetaMax, double thetaStep, uint64_t nThetaBins);
+		static bool Write(const std::string& filename, TableType type, const std::string& projectile, const std::string& material,
+						  double thetaMin, double thetaMax, double thetaStep, const std::vector<CubicSpline>& splines);
+
+	private:
+		void Close();
+
+		void* m_data;
+		uint64_t m_size;
+		const TableFileHeader* m_header;
+		const uint64_t* m_offsets;
+		const Spline* m_segments;
+
+		bool m_validFlag;
+
+		static constexpr char s_magic[8] = {'S','R','T','A','B','L','E','\0'};
+		static constexpr uint32_t s_version = 1;
+		static constexpr double s_thetaGridTolerance = 1.0e-3; //relative to the theta step; allows for rounding in text tables
+	};
+
+}
+
+#endif
@@ -0,0 +1,125 @@
+/*
+TableRegistry.h
+Energy loss tables (PunchTable, ElossTable) keyed by projectile (Z,A) and material (Z,A). Only the table header is read
+when a table is added, and the table itself is loaded the first time it is requested, so tables listed in the config
+but never used cost nothing. Pointers returned by Get stay valid for the life of the registry.
+
+Projectile/material names are isotope symbols as written by the table generator (i.e. 4He, 28Si1); only single isotope
+materials with stoichiometry 1 can be keyed.
+*/
+#ifndef TABLE_REGISTRY_H
+#define TABLE_REGISTRY_H
+
+#include "TableFile.h"
+#include "MassLookup.h"
+#include <unordered_map>
+#include <memory>
+#include <string>
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+
+namespace SabreRecon {
+
+	template<typename T, PunchTable::TableType type>
+	class TableRegistry
+	{
+	public:
+		TableRegistry() : m_interpolateTheta(false) {}
+		~TableRegistry() {}
+
+		//Applied to tables as they are loaded, so set it before the first Get
+		inline void SetInterpolateTheta(bool interpolate) { m_interpolateTheta = interpolate; }
+
+		bool Add(const std::string& filename)
+		{
+			std::string projectile, material;
+			if(!PunchTable::TableFile::ReadHeader(filename, type, projectile, material))
+			{
+				std::cerr<<"WARN -- Unable to read header of energy loss table "<<filename<<std::endl;
+				return false;
+			}
+
+			int zp, ap, zm, am, count;
+			if(!ParseIsotope(projectile, zp, ap, count) || count != 0 || !ParseIsotope(material, zm, am, count) || count != 1)
+			{
+				std::cerr<<"WARN -- Unable to key energy loss table "<<filename<<" with projectile "<<projectile<<" and material "<<material<<std::endl;
+				return false;
+			}
+
+			Entry entry;
+			entry.filename = filename;
+			if(!m_entries.emplace(MakeKey(zp, ap, zm, am), std::move(entry)).second)
+			{
+				std::cerr<<"WARN -- Energy loss table "<<filename<<" duplicates an already added table for "<<projectile<<" in "<<material<<"; ignoring it"<<std::endl;
+				return false;
+			}
+			return true;
+		}
+
+		//Returns nullptr if no table was added for this pair or it failed to load
+		T* Get(int zp, int ap, int zm, int am)
+		{
+			auto iter = m_entries.find(MakeKey(zp, ap, zm, am));
+			if(iter == m_entries.end())
+				return nullptr;
+
+			Entry& entry = iter->second;
+			if(entry.table == nullptr && !entry.loadFailed)
+			{
+				entry.table = std::make_unique<T>(entry.filename);
+				if(!entry.table->IsValid())
+				{
+					std::cerr<<"WARN -- Energy loss table "<<entry.filename<<" failed to load"<<std::endl;
+					entry.table.reset();
+					entry.loadFailed = true;
+				}
+				else
+					entry.table->SetInterpolateTheta(m_interpolateTheta);
+			}
+			return entry.table.get();
+		}
+
+		inline std::size_t GetNumberOfTables() const { return m_entries.size(); }
+
+	private:
+		struct Entry
+		{
+			std::string filename;
+			std::unique_ptr<T> table;
+			bool loadFailed = false;
+		};
+
+		static uint64_t MakeKey(int zp, int ap, int zm, int am)
+		{
+			return (uint64_t(zp & 0xFFFF) << 48) | (uint64_t(ap & 0xFFFF) << 32) | (uint64_t(zm & 0xFFFF) << 16) | uint64_t(am & 0xFFFF);
+		}
+
+		//<A><symbol><count>, count is optional (0 if absent)
+		static bool ParseIsotope(const std::string& isotope, int& z, int& a, int& count)
+		{
+			std::size_t pos = 0;
+			a = 0;
+			count = 0;
+			while(pos < isotope.size() && std::isdigit(isotope[pos]))
+				a = a*10 + (isotope[pos++] - '0');
+			std::size_t symbolStart = pos;
+			while(pos < isotope.size() && std::isalpha(isotope[pos]))
+				pos++;
+			std::string symbol = isotope.substr(symbolStart, pos - symbolStart);
+			while(pos < isotope.size() && std::isdigit(isotope[pos]))
+				count = count*10 + (isotope[pos++] - '0');
+
+			if(a == 0 || symbol.empty() || pos != isotope.size())
+				return false;
+			z = MassLookup::GetInstance().FindZ(symbol);
+			return z >= 0;
+		}
+
+		std::unordered_map<uint64_t, Entry> m_entries;
+		bool m_interpolateTheta;
+	};
+
+}
+
+#endif
@@ -14,17 +14,23 @@ Written by G.W. McCann Aug. 2020
 #include "EnergyLossConstants.h"
 #include "MassLookup.h"
 #include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <sstream>
 
 namespace SabreRecon {
 
+	const double Target::s_tableLogEnergyMin = std::log(Target::s_tableEnergyMin);
+	const double Target::s_tableLogEnergyStep = (std::log(Target::s_tableEnergyMax) - std::log(Target::s_tableEnergyMin))/(Target::s_nTableEnergies - 1);
+
 	Target::Target() :
-		m_totalThickness(0.0), m_isValid(false)
+		m_totalThickness(0.0), m_isValid(false), m_useReverseTables(true), m_useRangeTables(false), m_tables(std::make_shared<TableCache>())
 	{
 	}
 
 	/*Targets must be of known thickness*/
 	Target::Target(const std::vector<int>& a, const std::vector<int>& z, const std::vector<int>& stoich, double thick) :
-		m_isValid(false)
+		m_isValid(false), m_useReverseTables(true), m_useRangeTables(false)
 	{
 		SetParameters(a, z, stoich, thick);
 	}
@@ -37,119 +43,288 @@ namespace SabreRecon {
 	void Target::SetParameters(const std::vector<int>& a, const std::vector<int>& z, const std::vector<int>& stoich, double thick)
 	{
 		m_params.ZT = z;
+		m_params.composition.clear();
 		double denom = 0;
 		for(auto& s : stoich)
 			denom += s;
 		for(auto& s : stoich)
 			m_params.composition.push_back(s/denom);
+		if(!EnergyLoss::InitCoefficients(m_params))
+			std::cerr<<"WARN -- Target composition not supported by the in-house stopping powers (max "<<EnergyLoss::maxTargetElements<<" elements)"<<std::endl;
 		m_totalThickness = thick;
 		m_totalThickness_gcm2 = m_totalThickness*1.0e-6;
 
 		auto& masses = MassLookup::GetInstance();
+		m_material = catima::Material();
 		for(size_t i=0; i<z.size(); i++)
 		{
 			m_material.add_element(masses.FindMassU(z[i], a[i]), z[i], stoich[i]);
 		}
+		m_tables = std::make_shared<TableCache>(); //new material, don't touch tables shared with copies of the old one
 		m_isValid = true;
 	}
 	
 	/*Calculates energy loss for travelling all the way through the target*/
-	double Target::GetEnergyLossTotal(int zp, int ap, double startEnergy, double theta)
+	double Target::GetEnergyLossTotal(int zp, int ap, double startEnergy, double theta) const
 	{
-		m_params.ZP = zp;
-		m_params.massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		return GetEnergyLossFractionalDepth(zp, ap, startEnergy, theta, 1.0);
+	}
 
-		if(theta == M_PI/2.) 
+	/*Calculates the energy loss for traveling some fraction through the target*/
+	double Target::GetEnergyLossFractionalDepth(int zp, int ap, double startEnergy, double theta, double percent_depth) const
+	{
+		if(theta == M_PI/2.)
 			return startEnergy;
-		else if (theta > M_PI/2.) 
-			theta = M_PI - theta;
-
-		m_params.energy = startEnergy;
-		m_params.thickness = m_totalThickness/(std::fabs(std::cos(theta)));
+		else if (theta > M_PI/2.)
+			theta = M_PI-theta;
 
-		m_projectile.A = MassLookup::GetInstance().FindMassU(zp, ap);
-		m_projectile.Z = zp;
-		m_projectile.Q = zp;
-		m_projectile.T = startEnergy/m_projectile.A;
-		m_material.thickness(m_totalThickness_gcm2/(std::fabs(std::cos(theta))));
+		if(m_useRangeTables)
+		{
+			const EnergyLoss::RangeTable* table = GetRangeTable(zp, ap);
+			if(table != nullptr)
+				return EnergyLoss::GetEnergyLossFromRange(*table, startEnergy, m_totalThickness*percent_depth/std::fabs(std::cos(theta)));
+		}
 
-		return catima::integrate_energyloss(m_projectile, m_material);
-		//return EnergyLoss::GetEnergyLoss(m_params);
+		return CalculateEnergyLoss(zp, ap, startEnergy, m_totalThickness_gcm2*percent_depth/(std::fabs(std::cos(theta))));
 	}
-
-	/*Calculates the energy loss for traveling some fraction through the target*/
-	double Target::GetEnergyLossFractionalDepth(int zp, int ap, double startEnergy, double theta, double percent_depth)
+	
+	/*Calculates reverse energy loss for travelling all the way through the target*/
+	double Target::GetReverseEnergyLossTotal(int zp, int ap, double finalEnergy, double theta) const
 	{
-		m_params.ZP = zp;
-		m_params.massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		return GetReverseEnergyLossFractionalDepth(zp, ap, finalEnergy, theta, 1.0);
+	}
 
+	/*Calculates the reverse energy loss for traveling some fraction through the target*/
+	double Target::GetReverseEnergyLossFractionalDepth(int zp, int ap, double finalEnergy, double theta, double percent_depth) const
+	{
 		if(theta == M_PI/2.)
-			return startEnergy;
+			return finalEnergy;
 		else if (theta > M_PI/2.)
 			theta = M_PI-theta;
 
-		m_params.energy = startEnergy;
-		m_params.thickness = m_totalThickness*percent_depth/(std::fabs(std::cos(theta)));
+		if(m_useRangeTables)
+		{
+			const EnergyLoss::RangeTable* table = GetRangeTable(zp, ap);
+			if(table != nullptr)
+				return EnergyLoss::GetReverseEnergyLossFromRange(*table, finalEnergy, m_totalThickness*percent_depth/std::fabs(std::cos(theta)));
+		}
 
-		m_projectile.A = MassLookup::GetInstance().FindMassU(zp, ap);
-		m_projectile.Z = zp;
-		m_projectile.Q = zp;
-		m_projectile.T = startEnergy/m_projectile.A;
-		m_material.thickness(m_totalThickness_gcm2*percent_depth/(std::fabs(std::cos(theta))));
+		double secant = 1.0/std::fabs(std::cos(theta));
+		if(m_useReverseTables && IsInReverseTableRange(finalEnergy, secant))
+			return InterpolateReverseTable(GetReverseTable(zp, ap, percent_depth), finalEnergy, secant);
 
-		return catima::integrate_energyloss(m_projectile, m_material);
+		return CalculateReverseEnergyLoss(zp, ap, finalEnergy, m_totalThickness_gcm2*percent_depth/(std::fabs(std::cos(theta))));
+	}
 
-		//return EnergyLoss::GetEnergyLoss(m_params);
+	void Target::GetReverseEnergyLossTotal(int zp, int ap, const double* finalEnergy, const double* theta, double* eloss, std::size_t n) const
+	{
+		GetReverseEnergyLossFractionalDepth(zp, ap, finalEnergy, theta, 1.0, eloss, n);
 	}
-	
-	/*Calculates reverse energy loss for travelling all the way through the target*/
-	double Target::GetReverseEnergyLossTotal(int zp, int ap, double finalEnergy, double theta)
+
+	/*Same branches as the scalar version, with the range/reverse table looked up (and locked for) once instead of per call*/
+	void Target::GetReverseEnergyLossFractionalDepth(int zp, int ap, const double* finalEnergy, const double* theta, double percent_depth, double* eloss,
+													 std::size_t n) const
 	{
-		m_params.ZP = zp;
-		m_params.massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		const EnergyLoss::RangeTable* rangeTable = m_useRangeTables ? GetRangeTable(zp, ap) : nullptr;
+		const ReverseTable* reverseTable = nullptr;
+		double angle, secant;
+		for(std::size_t i=0; i<n; i++)
+		{
+			angle = theta[i];
+			if(angle == M_PI/2.)
+			{
+				eloss[i] = finalEnergy[i];
+				continue;
+			}
+			else if(angle > M_PI/2.)
+				angle = M_PI-angle;
 
-		if(theta == M_PI/2.) 
-			return finalEnergy;
-		else if (theta > M_PI/2.) 
-			theta = M_PI - theta;
+			if(rangeTable != nullptr)
+			{
+				eloss[i] = EnergyLoss::GetReverseEnergyLossFromRange(*rangeTable, finalEnergy[i], m_totalThickness*percent_depth/std::fabs(std::cos(angle)));
+				continue;
+			}
 
-		m_params.energy = finalEnergy;
-		m_params.thickness = m_totalThickness/(std::fabs(std::cos(theta)));
+			secant = 1.0/std::fabs(std::cos(angle));
+			if(m_useReverseTables && IsInReverseTableRange(finalEnergy[i], secant))
+			{
+				if(reverseTable == nullptr)
+					reverseTable = &GetReverseTable(zp, ap, percent_depth);
+				eloss[i] = InterpolateReverseTable(*reverseTable, finalEnergy[i], secant);
+			}
+			else
+				eloss[i] = CalculateReverseEnergyLoss(zp, ap, finalEnergy[i], m_totalThickness_gcm2*percent_depth/(std::fabs(std::cos(angle))));
+		}
+	}
 
-		m_projectile.A = MassLookup::GetInstance().FindMassU(zp, ap);
-		m_projectile.Z = zp;
-		m_projectile.Q = zp;
-		m_projectile.T = finalEnergy/m_projectile.A;
-		m_material.thickness(m_totalThickness_gcm2/(std::fabs(std::cos(theta))));
+	/*
+		catima takes the thickness from the material, so each thread sets it on its own scratch copy. Assigning into the
+		scratch reuses its storage, so there is no allocation per call.
+	*/
+	const catima::Material& Target::GetMaterial(double thickness_gcm2) const
+	{
+		static thread_local catima::Material material;
+		material = m_material;
+		material.thickness(thickness_gcm2);
+		return material;
+	}
 
-		return catima::reverse_integrate_energyloss(m_projectile, m_material);
+	/*Full catima integrations through a given areal thickness (g/cm^2)*/
+	double Target::CalculateEnergyLoss(int zp, int ap, double startEnergy, double thickness_gcm2) const
+	{
+		catima::Projectile projectile;
+		projectile.A = MassLookup::GetInstance().FindMassU(zp, ap);
+		projectile.Z = zp;
+		projectile.Q = zp;
+		projectile.T = startEnergy/projectile.A;
 
-		//return EnergyLoss::GetReverseEnergyLoss(m_params);
+		return catima::integrate_energyloss(projectile, GetMaterial(thickness_gcm2));
 	}
 
-	/*Calculates the reverse energy loss for traveling some fraction through the target*/
-	double Target::GetReverseEnergyLossFractionalDepth(int zp, int ap, double finalEnergy, double theta, double percent_depth)
+	double Target::CalculateReverseEnergyLoss(int zp, int ap, double finalEnergy, double thickness_gcm2) const
 	{
-		m_params.ZP = zp;
-		m_params.massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		catima::Projectile projectile;
+		projectile.A = MassLookup::GetInstance().FindMassU(zp, ap);
+		projectile.Z = zp;
+		projectile.Q = zp;
+		projectile.T = finalEnergy/projectile.A;
 
-		if(theta == M_PI/2.)
-			return finalEnergy;
-		else if (theta > M_PI/2.)
-			theta = M_PI-theta;
+		return catima::reverse_integrate_energyloss(projectile, GetMaterial(thickness_gcm2));
+	}
+
+	/*
+		Tables are built outside of the lock so that a build does not stall threads using other tables, and only inserted
+		under it. If another thread inserted the same table meanwhile, its table is used and the new one dropped.
+	*/
+	const EnergyLoss::RangeTable* Target::GetRangeTable(int zp, int ap) const
+	{
+		{
+			std::lock_guard<std::mutex> guard(m_tables->mutex);
+			const RangeTableEntry* entry = FindRangeTable(zp, ap);
+			if(entry != nullptr)
+				return entry->isValid ? &entry->table : nullptr;
+		}
+
+		RangeTableEntry built;
+		built.zp = zp;
+		built.ap = ap;
+		EnergyLoss::Parameters params = m_params;
+		params.ZP = zp;
+		params.massP = MassLookup::GetInstance().FindMass(zp, ap)*EnergyLoss::mev2u;
+		built.isValid = EnergyLoss::BuildRangeTable(params, built.table);
+
+		std::lock_guard<std::mutex> guard(m_tables->mutex);
+		const RangeTableEntry* entry = FindRangeTable(zp, ap);
+		if(entry == nullptr)
+		{
+			if(!built.isValid)
+				std::cerr<<"WARN -- Unable to build range table for (Z,A)=("<<zp<<","<<ap<<"), falling back to catima"<<std::endl;
+			m_tables->rangeTables.push_back(std::move(built));
+			entry = &m_tables->rangeTables.back();
+		}
+		return entry->isValid ? &entry->table : nullptr;
+	}
+
+	//Tables are never modified once inserted, so the reference stays valid and can be read without the lock
+	const Target::ReverseTable& Target::GetReverseTable(int zp, int ap, double percent_depth) const
+	{
+		{
+			std::lock_guard<std::mutex> guard(m_tables->mutex);
+			const ReverseTable* table = FindReverseTable(zp, ap, percent_depth);
+			if(table != nullptr)
+				return *table;
+		}
+
+		ReverseTable built;
+		built.zp = zp;
+		built.ap = ap;
+		built.depthFraction = percent_depth;
+		BuildReverseTable(built);
+
+		std::lock_guard<std::mutex> guard(m_tables->mutex);
+		const ReverseTable* table = FindReverseTable(zp, ap, percent_depth);
+		if(table != nullptr)
+			return *table;
+		m_tables->reverseTables.push_back(std::move(built));
+		return m_tables->reverseTables.back();
+	}
+
+	//Callers hold the table lock
+	const Target::RangeTableEntry* Target::FindRangeTable(int zp, int ap) const
+	{
+		for(auto& entry : m_tables->rangeTables)
+		{
+			if(entry.zp == zp && entry.ap == ap)
+				return &entry;
+		}
+		return nullptr;
+	}
 
-		m_params.energy = finalEnergy;
-		m_params.thickness = m_totalThickness*percent_depth/(std::fabs(std::cos(theta)));
+	const Target::ReverseTable* Target::FindReverseTable(int zp, int ap, double percent_depth) const
+	{
+		for(auto& table : m_tables->reverseTables)
+		{
+			if(table.zp == zp && table.ap == ap && table.depthFraction == percent_depth)
+				return &table;
+		}
+		return nullptr;
+	}
 
-		m_projectile.A = MassLookup::GetInstance().FindMassU(zp, ap);
-		m_projectile.Z = zp;
-		m_projectile.Q = zp;
-		m_projectile.T = finalEnergy/m_projectile.A;
-		m_material.thickness(m_totalThickness_gcm2*percent_depth/(std::fabs(std::cos(theta))));
+	//Fill the table from catima, then sample the bilinear interpolation at cell centers against the full integration
 
-		return catima::reverse_integrate_energyloss(m_projectile, m_material);
+	void Target::BuildReverseTable(ReverseTable& table) const
+	{
+		double thickness = m_totalThickness_gcm2*table.depthFraction;
+		double energy, secant;
+		table.values.resize(s_nTableEnergies*s_nTableSecants);
+		for(int i=0; i<s_nTableEnergies; i++)
+		{
+			energy = std::exp(s_tableLogEnergyMin + i*s_tableLogEnergyStep);
+			for(int j=0; j<s_nTableSecants; j++)
+			{
+				secant = 1.0 + j*s_tableSecantStep;
+				table.values[i*s_nTableSecants + j] = CalculateReverseEnergyLoss(table.zp, table.ap, energy, thickness*secant);
+			}
+		}
+
+		double exact;
+		std::ostringstream name;
+		name<<"reverse energy loss (Z,A)=("<<table.zp<<","<<table.ap<<") depth fraction "<<table.depthFraction;
+		table.accuracy.name = name.str();
+		for(int i=0; i<s_nTableEnergies-1; i+=10)
+		{
+			energy = std::exp(s_tableLogEnergyMin + (i + 0.5)*s_tableLogEnergyStep);
+			for(int j=0; j<s_nTableSecants-1; j+=5)
+			{
+				secant = 1.0 + (j + 0.5)*s_tableSecantStep;
+				exact = CalculateReverseEnergyLoss(table.zp, table.ap, energy, thickness*secant);
+				if(exact <= 0.0)
+					continue;
+				table.accuracy.Add(InterpolateReverseTable(table, energy, secant), exact);
+			}
+		}
+	}
+
+	void Target::GetTableAccuracy(std::vector<TableAccuracy>& accuracy) const
+	{
+		std::lock_guard<std::mutex> guard(m_tables->mutex);
+		for(auto& table : m_tables->reverseTables)
+			accuracy.push_back(table.accuracy);
+	}
+
+	/*Bilinear interpolation; caller guarantees (finalEnergy, secant) is inside the grid*/
+	double Target::InterpolateReverseTable(const ReverseTable& table, double finalEnergy, double secant) const
+	{
+		double energyIndex = (std::log(finalEnergy) - s_tableLogEnergyMin)/s_tableLogEnergyStep;
+		double secantIndex = (secant - 1.0)/s_tableSecantStep;
+		int ie = std::min(int(energyIndex), s_nTableEnergies-2);
+		int is = std::min(int(secantIndex), s_nTableSecants-2);
+		double fe = energyIndex - ie;
+		double fs = secantIndex - is;
 
-		//return EnergyLoss::GetReverseEnergyLoss(m_params);
+		const double* low = &table.values[ie*s_nTableSecants + is];
+		const double* high = low + s_nTableSecants;
+		return (1.0-fe)*((1.0-fs)*low[0] + fs*low[1]) + fe*((1.0-fs)*high[0] + fs*high[1]);
 	}
 
 }
@@ -15,11 +15,45 @@ Written by G.W. McCann Aug. 2020
 
 #include <string>
 #include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
 #include "EnergyLoss.h"
 #include "catima/gwm_integrators.h"
 
 namespace SabreRecon {
 
+	//Deviation of a lazily built table from the calculation it replaces, sampled between its knots when it is built
+	struct TableAccuracy
+	{
+		std::string name;
+		std::size_t nSamples = 0;
+		double maxDeviation = 0.0; //MeV
+		double maxRelDeviation = 0.0;
+		double sumSqRelDeviation = 0.0;
+
+		inline void Add(double value, double exact)
+		{
+			double deviation = std::fabs(value - exact);
+			maxDeviation = std::max(maxDeviation, deviation);
+			if(exact != 0.0)
+			{
+				maxRelDeviation = std::max(maxRelDeviation, deviation/std::fabs(exact));
+				sumSqRelDeviation += (deviation/exact)*(deviation/exact);
+			}
+			nSamples++;
+		}
+		inline double GetRMSRelDeviation() const { return nSamples == 0 ? 0.0 : std::sqrt(sumSqRelDeviation/nSamples); }
+	};
+
+	/*
+		All energy loss methods are const and keep their per-call state on the stack (or in per-thread scratch), so a single
+		Target can be shared between threads. The lazily built tables live in a cache guarded by a mutex; copies of a Target
+		share the cache, since they describe the same material.
+	*/
 	class Target
 	{
 
@@ -29,22 +63,89 @@ namespace SabreRecon {
 	 	~Target();
 
 	 	void SetParameters(const std::vector<int>& a, const std::vector<int>& z, const std::vector<int>& stoich, double thick);
-	 	double GetEnergyLossTotal(int zp, int ap, double startEnergy, double angle);
-	 	double GetReverseEnergyLossTotal(int zp, int ap, double finalEnergy, double angle);
-	 	double GetEnergyLossFractionalDepth(int zp, int ap, double startEnergy, double angle, double percent_depth);
-	 	double GetReverseEnergyLossFractionalDepth(int zp, int ap, double finalEnergy, double angle, double percent_depth);
+	 	double GetEnergyLossTotal(int zp, int ap, double startEnergy, double angle) const;
+	 	double GetReverseEnergyLossTotal(int zp, int ap, double finalEnergy, double angle) const;
+	 	double GetEnergyLossFractionalDepth(int zp, int ap, double startEnergy, double angle, double percent_depth) const;
+	 	double GetReverseEnergyLossFractionalDepth(int zp, int ap, double finalEnergy, double angle, double percent_depth) const;
+	 	//Batch versions filling eloss[i] for each (finalEnergy[i], angle[i]); the tables are resolved once for the whole batch
+	 	void GetReverseEnergyLossTotal(int zp, int ap, const double* finalEnergy, const double* angle, double* eloss, std::size_t n) const;
+	 	void GetReverseEnergyLossFractionalDepth(int zp, int ap, const double* finalEnergy, const double* angle, double percent_depth, double* eloss,
+	 											 std::size_t n) const;
+
+	 	//Appends the accuracy of every reverse table built so far
+	 	void GetTableAccuracy(std::vector<TableAccuracy>& accuracy) const;
 
 	 	inline const EnergyLoss::Parameters& GetParameters() const { return m_params; }
 	 	inline const double GetTotalThickness() const { return m_totalThickness; }
-	 	inline const bool IsValid() { return m_isValid; }
+	 	inline const bool IsValid() const { return m_isValid; }
+	 	//Table switches are configuration; set them before sharing the Target between threads
+	 	inline void SetUseReverseTables(bool use) { m_useReverseTables = use; }
+	 	//Range tables use the in-house (Ziegler) stopping powers and take precedence over catima and the reverse tables
+	 	inline void SetUseRangeTables(bool use) { m_useRangeTables = use; }
 	
 	private:
+		/*
+			Reverse energy loss for one projectile at one depth fraction, tabulated over final energy (log spaced)
+			and path length factor 1/cos(theta) (uniform). Built from catima on first use.
+		*/
+		struct ReverseTable
+		{
+			int zp = 0;
+			int ap = 0;
+			double depthFraction = 0.0;
+			std::vector<double> values; //energy major, s_nTableSecants entries per energy
+			TableAccuracy accuracy;
+		};
+
+		struct RangeTableEntry
+		{
+			int zp = 0;
+			int ap = 0;
+			bool isValid = false;
+			EnergyLoss::RangeTable table;
+		};
+
+		//deques so table addresses stay fixed as projectiles are added
+		struct TableCache
+		{
+			std::mutex mutex;
+			std::deque<ReverseTable> reverseTables;
+			std::deque<RangeTableEntry> rangeTables;
+		};
+
+		const EnergyLoss::RangeTable* GetRangeTable(int zp, int ap) const;
+		const ReverseTable& GetReverseTable(int zp, int ap, double percent_depth) const;
+		const RangeTableEntry* FindRangeTable(int zp, int ap) const;
+		const ReverseTable* FindReverseTable(int zp, int ap, double percent_depth) const;
+		const catima::Material& GetMaterial(double thickness_gcm2) const;
+		void BuildReverseTable(ReverseTable& table) const;
+		double InterpolateReverseTable(const ReverseTable& table, double finalEnergy, double secant) const;
+		double CalculateEnergyLoss(int zp, int ap, double startEnergy, double thickness_gcm2) const;
+		double CalculateReverseEnergyLoss(int zp, int ap, double finalEnergy, double thickness_gcm2) const;
+		inline bool IsInReverseTableRange(double finalEnergy, double secant) const
+		{
+			return finalEnergy >= s_tableEnergyMin && finalEnergy < s_tableEnergyMax && secant < s_tableSecantMax;
+		}
+
 		EnergyLoss::Parameters m_params;
 		catima::Material m_material;
-		catima::Projectile m_projectile;
 		double m_totalThickness;
 		double m_totalThickness_gcm2;
 		bool m_isValid;
+
+		bool m_useReverseTables;
+		bool m_useRangeTables;
+		std::shared_ptr<TableCache> m_tables;
+
+		//Reverse table grid. Outside of the grid the full catima integration is used.
+		static constexpr int s_nTableEnergies = 200;
+		static constexpr double s_tableEnergyMin = 0.1; //MeV
+		static constexpr double s_tableEnergyMax = 50.0; //MeV
+		static constexpr int s_nTableSecants = 46;
+		static constexpr double s_tableSecantStep = 0.2;
+		static constexpr double s_tableSecantMax = 1.0 + (s_nTableSecants - 1)*s_tableSecantStep; //~84 deg
+		static const double s_tableLogEnergyMin;
+		static const double s_tableLogEnergyStep;
 	};
 
 }
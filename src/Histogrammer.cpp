@@ -1,5 +1,6 @@
 #include "Histogrammer.h"
 #include "CalDict/DataStructs.h"
+#include "Kinematics/RootConversion.h"
 #include <iostream>
 #include <fstream>
 #include <TH1.h>
@@ -10,16 +11,25 @@
 
 namespace SabreRecon {
 
+	//Reactions histogrammed for the 10B(3He,a) data; an 16O target contaminant gives the 14N channel
+	using Rxn9B = Reaction<Nuclide<5,10>, Nuclide<2,3>, Nuclide<3,4>>;
+	using Rxn5Li = Reaction<Nuclide<5,10>, Nuclide<2,3>, Nuclide<2,4>, Nuclide<2,4>>;
+	using Rxn8Be = Reaction<Nuclide<5,10>, Nuclide<2,3>, Nuclide<2,4>, Nuclide<1,1>>;
+	using Rxn7Be = Reaction<Nuclide<5,10>, Nuclide<2,3>, Nuclide<2,4>, Nuclide<1,2>>;
+	using Rxn14N = Reaction<Nuclide<8,16>, Nuclide<2,3>, Nuclide<2,4>, Nuclide<1,1>>;
+
 	double Phi360(double phi)
 	{
 		return phi < 0 ? (2.0*M_PI + phi) : phi;
 	}
 
 	Histogrammer::Histogrammer(const std::string& input) :
-		m_inputData(""), m_outputData(""), m_eventPtr(new CalEvent), m_isValid(false)
+		m_inputData(""), m_outputData(""), m_eventPtr(new CalEvent), m_seed(0), m_precision(ReconPrecision::Exact),
+		m_interpolateTableTheta(false), m_nValidationEvents(0), m_nValidatedEvents(0), m_isValid(false)
 	{
 		TH1::AddDirectory(kFALSE);
 		ParseConfig(input);
+		BookHistograms();
 		//As of Ubuntu 22.04: linker aggresively strips (particularly for release) to the point where non-header symbols MUST be called AND used
 		//within the executable. Use EnforceDictionaryLinked as shown.
 		if(EnforceDictionaryLinked())
@@ -54,6 +64,18 @@ namespace SabreRecon {
 
 		std::vector<std::string> ptables;
 		std::vector<std::string> etables;
+		bool useRangeTables = false; //target energy loss from in-house range tables instead of catima; optional in the config
+
+		//Breakup cuts, unless given in the config
+		m_breakupCuts8Be.hitEMin = s_weakSabreThreshold;
+		m_breakupCuts8Be.sumEMin = 0.5;
+		m_breakupCuts8Be.sumEMax = 30.0;
+		m_breakupCuts8Be.openingMax = 90.0/s_rad2deg;
+		m_breakupCuts12C.hitEMin = s_weakSabreThreshold;
+		m_breakupCuts12C.sumEMin = 1.0;
+		m_breakupCuts12C.sumEMax = 40.0;
+		m_breakupCuts12C.openingMax = 120.0/s_rad2deg;
+		std::string breakupDetectors8Be = "same_adjacent", breakupDetectors12C = "same_adjacent";
 
 		input>>junk;
 		if(junk == "begin_data")
@@ -146,6 +168,47 @@ namespace SabreRecon {
 						std::cout<<"Adding ElossTable: "<<junk<<std::endl;
 					}
 				}
+				else if(junk == "seed")
+				{
+					input>>m_seed;
+					std::cout<<"Smearing seed: "<<m_seed<<std::endl;
+				}
+				else if(junk == "precision")
+				{
+					input>>junk;
+					if(junk == "fast")
+						m_precision = ReconPrecision::Fast;
+					else if(junk == "exact")
+						m_precision = ReconPrecision::Exact;
+					else
+						std::cerr<<"WARN -- Unknown reconstruction precision "<<junk<<"; using exact"<<std::endl;
+					std::cout<<"Reconstruction precision: "<<(m_precision == ReconPrecision::Fast ? "fast" : "exact")<<std::endl;
+				}
+				else if(junk == "begin_breakup_8Be")
+					ReadBreakupCuts(input, "end_breakup_8Be", m_breakupCuts8Be, breakupDetectors8Be);
+				else if(junk == "begin_breakup_12C")
+					ReadBreakupCuts(input, "end_breakup_12C", m_breakupCuts12C, breakupDetectors12C);
+				else if(junk == "target_energy_loss")
+				{
+					input>>junk;
+					useRangeTables = junk == "ranges";
+					if(junk != "ranges" && junk != "catima")
+						std::cerr<<"WARN -- Unknown target energy loss mode "<<junk<<"; using catima"<<std::endl;
+					std::cout<<"Target energy loss: "<<(useRangeTables ? "ranges" : "catima")<<std::endl;
+				}
+				else if(junk == "interpolate_table_theta")
+				{
+					input>>junk;
+					m_interpolateTableTheta = junk == "on";
+					if(junk != "on" && junk != "off")
+						std::cerr<<"WARN -- Unknown table theta interpolation "<<junk<<"; using off"<<std::endl;
+					std::cout<<"Table theta interpolation: "<<(m_interpolateTableTheta ? "on" : "off")<<std::endl;
+				}
+				else if(junk == "validate_precision")
+				{
+					input>>m_nValidationEvents;
+					std::cout<<"Validating the fast precision tier against exact over "<<m_nValidationEvents<<" SABRE events"<<std::endl;
+				}
 				else if(junk == "end_focalplane")
 					continue;
 				else if(junk == "end_target")
@@ -178,11 +241,35 @@ namespace SabreRecon {
 		//init resources
 		std::cout<<"Initializing resources..."<<std::endl;
 		Target target(targ_a, targ_z, targ_s, thickness);
+		target.SetUseRangeTables(useRangeTables);
+		RandomGenerator::SetSeed(m_seed);
 		m_recon.Init(target, theta, B, fpCal);
+		m_recon.SetPrecision(m_precision);
+		m_recon.SetInterpolateTableTheta(m_interpolateTableTheta);
 		for(auto& table : ptables)
 			m_recon.AddPunchThruTable(table);
 		for(auto& table : etables)
 			m_recon.AddEnergyLossTable(table);
+		m_rxn9B = m_recon.CreateReactionContext<Rxn9B>(m_beamKE);
+		m_rxn5Li = m_recon.CreateReactionContext<Rxn5Li>(m_beamKE);
+		m_rxn8Be = m_recon.CreateReactionContext<Rxn8Be>(m_beamKE);
+		m_rxn7Be = m_recon.CreateReactionContext<Rxn7Be>(m_beamKE);
+		m_rxn14N = m_recon.CreateReactionContext<Rxn14N>(m_beamKE);
+		m_sabreHypotheses[0] = {&m_rxn9B};
+		m_sabreHypotheses[1] = {&m_rxn5Li};
+		m_sabreHypotheses[2] = {&m_rxn8Be};
+		m_sabreHypotheses[3] = {&m_rxn7Be};
+		m_sabreHypotheses[4] = {&m_rxn14N};
+		m_degradedHypotheses[0] = {&m_rxn9B};
+		m_degradedHypotheses[1] = {&m_rxn5Li};
+		m_degradedHypotheses[2] = {&m_rxn7Be};
+		m_degradedHypotheses[3] = {&m_rxn8Be};
+		m_degradedHypotheses[4] = {&m_rxn8Be, SabreEnergyModel::Degraded};
+		m_degradedHypotheses[5] = {&m_rxn8Be, SabreEnergyModel::PunchDegraded};
+		m_breakup8Be = m_recon.CreateBreakupContext({{2, 4}, {2, 4}});
+		m_breakup12C = m_recon.CreateBreakupContext({{2, 4}, {2, 4}, {2, 4}});
+		m_breakupCuts8Be.detectorPairs = GetBreakupDetectorPairs(breakupDetectors8Be);
+		m_breakupCuts12C.detectorPairs = GetBreakupDetectorPairs(breakupDetectors12C);
 		m_cuts.InitCuts(cuts);
 		m_cuts.InitEvent(m_eventPtr);
 
@@ -190,33 +277,181 @@ namespace SabreRecon {
 			m_isValid = true;
 	}
 
-	void Histogrammer::FillHistogram1D(const Histogram1DParams& params, double value)
+	/*
+		Breakup cuts block, by position after each label:
+			hitEMin(MeV) <min>
+			sumE(MeV) <min> <max>
+			opening(deg) <min> <max>
+			detectors <all|same|adjacent|same_adjacent>
+		followed by the end token.
+	*/
+	void Histogrammer::ReadBreakupCuts(std::istream& input, const std::string& endToken, BreakupCuts& cuts, std::string& detectors)
 	{
-		std::shared_ptr<TH1> h = std::static_pointer_cast<TH1>(m_histoMap[params.name]);
-		if(h)
-			h->Fill(value);
-		else
-		{
-			h = std::make_shared<TH1F>(params.name.c_str(), params.title.c_str(), params.bins, params.min, params.max);
-			h->Fill(value);
-			m_histoMap[params.name] = h;
-		}
+		std::string junk;
+		double openingMin, openingMax;
+		input>>junk>>cuts.hitEMin;
+		input>>junk>>cuts.sumEMin>>cuts.sumEMax;
+		input>>junk>>openingMin>>openingMax;
+		input>>junk>>detectors;
+		input>>junk;
+		if(junk != endToken)
+			std::cerr<<"WARN -- Expected "<<endToken<<" after the breakup cuts, found "<<junk<<std::endl;
+		cuts.openingMin = openingMin/s_rad2deg;
+		cuts.openingMax = openingMax/s_rad2deg;
+		std::cout<<"Breakup cuts until "<<endToken<<" -- hit E > "<<cuts.hitEMin<<" MeV, sum E ["<<cuts.sumEMin<<", "<<cuts.sumEMax
+				 <<"] MeV, opening angle ["<<openingMin<<", "<<openingMax<<"] deg, detectors: "<<detectors<<std::endl;
 	}
 
-	void Histogrammer::FillHistogram2D(const Histogram2DParams& params, double valueX, double valueY)
+	uint32_t Histogrammer::GetBreakupDetectorPairs(const std::string& detectors) const
 	{
-		std::shared_ptr<TH1> h = std::static_pointer_cast<TH2>(m_histoMap[params.name]);
-		if(h)
-			h->Fill(valueX, valueY);
-		else
+		if(detectors == "all")
+			return BreakupCuts().detectorPairs;
+		else if(detectors == "same")
+			return m_recon.GetDetectorPairMask(true, false);
+		else if(detectors == "adjacent")
+			return m_recon.GetDetectorPairMask(false, true);
+		else if(detectors != "same_adjacent")
+			std::cerr<<"WARN -- Unknown breakup detector pairs "<<detectors<<"; using same_adjacent"<<std::endl;
+		return m_recon.GetDetectorPairMask(true, true);
+	}
+
+	Histogram1DHandle Histogrammer::BookHistogram1D(const Histogram1DParams& params)
+	{
+		auto iter = m_bookedNames1D.find(params.name);
+		if(iter != m_bookedNames1D.end())
+			return {iter->second};
+
+		Histogram1DHandle handle = {m_histograms1D.size()};
+		m_histograms1D.emplace_back();
+		m_histograms1D.back().params = params;
+		m_bookedNames1D[params.name] = handle.index;
+		return handle;
+	}
+
+	Histogram2DHandle Histogrammer::BookHistogram2D(const Histogram2DParams& params)
+	{
+		auto iter = m_bookedNames2D.find(params.name);
+		if(iter != m_bookedNames2D.end())
+			return {iter->second};
+
+		Histogram2DHandle handle = {m_histograms2D.size()};
+		m_histograms2D.emplace_back();
+		m_histograms2D.back().params = params;
+		m_bookedNames2D[params.name] = handle.index;
+		return handle;
+	}
+
+	void Histogrammer::BookHistograms()
+	{
+		//Run
+		m_hXavgGated = BookHistogram1D({"xavg_gated","xavg_gated;xavg;counts",600,-300.0,300.0});
+		m_hSabreCountsGated = BookHistogram1D({"sabre_counts_gated","sabre_counts_gated;number per event;counts",10,-1.0, 9.0});
+		//RunBreakups
+		m_hBreakup8BeCandidates = BookHistogram1D({"breakup_8Be_candidates","breakup_8Be_candidates;number per event;counts",20,0.0,20.0});
+		m_hEx8Be2a = BookHistogram1D({"ex_8Be_2a","ex_8Be_2a;E_x(MeV);counts",3000,-5.0,25.0});
+		m_hSumKEEx8Be2a = BookHistogram2D({"sumKE_ex_8Be_2a","sumKE_ex_8Be_2a;E_x(MeV);#sum KE(MeV)",300,-5.0,25.0,400,0.0,40.0});
+		m_hBreakup12CCandidates = BookHistogram1D({"breakup_12C_candidates","breakup_12C_candidates;number per event;counts",20,0.0,20.0});
+		m_hEx12C3a = BookHistogram1D({"ex_12C_3a","ex_12C_3a;E_x(MeV);counts",3000,-5.0,25.0});
+		m_hSumKEEx12C3a = BookHistogram2D({"sumKE_ex_12C_3a","sumKE_ex_12C_3a;E_x(MeV);#sum KE(MeV)",300,-5.0,25.0,400,0.0,40.0});
+		//RunSabre
+		m_hXavgGatedSabre = BookHistogram1D({"xavg_gated_sabre","xavg_gated_sabre;xavg;counts",600,-300.0,300.0});
+		m_hScintECathodeE = BookHistogram2D({"scintE_cathodeE","scintE_cathodeE;scintE;cathodeE",512,0,4096,512,0,4096});
+		m_hXavgTheta = BookHistogram2D({"xavg_theta","xavg_theta;xavg;theta",600,-300.0,300.0,500,0.0,1.5});
+		m_hEx5Li = BookHistogram1D({"ex_5Li","ex_5Li;E_x(MeV);counts",3000,-5.0,25.0});
+		m_hEx7Be = BookHistogram1D({"ex_7Be","ex_7Be;E_x(MeV);counts",3000,-20.0,10.0});
+		m_hEx8Be = BookHistogram1D({"ex_8Be","ex_8Be;E_x(MeV);counts",3000,-5.0,25.0});
+		m_hEx14N = BookHistogram1D({"ex_14N","ex_14N;E_x(MeV);counts",3000,-20.0,10.0});
+		m_hEx14N7Be = BookHistogram2D({"ex_14N_7Be","ex_14N_7Be;E_x 14N;E_x 7Be",500,-10.0,10.0,500,-10.,10.0});
+		m_hSabreThetaSabreE = BookHistogram2D({"sabreTheta_sabreE","sabreTheta_sabreE;#theta (deg); E(MeV)",180,0,180,400,0,20.0});
+		m_hXavgSabreE = BookHistogram2D({"xavg_sabreE","xavg_sabreE;xavg; E(MeV)",600,-300.0,300.0,400,0,20.0});
+		m_h9BthetaSabreTheta = BookHistogram2D({"9Btheta_sabreTheta","9Btheta_sabreTheta;#theta_{9B};#theta_{SABRE}",180,0.0,180.0,180,0.0,180.0});
+		m_hSabreERelAngle = BookHistogram2D({"sabreE_relAngle","sabreE_relAngle;#theta_{rel};E(MeV)",180,0.0,180.0,400,0.0,20.0});
+		m_hSabreTheta5Liex = BookHistogram2D({"sabreTheta_5Liex","sabreTheta_5Liex;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-5.0,25.0});
+		m_hSabreTheta7Beex = BookHistogram2D({"sabreTheta_7Beex","sabreTheta_7Beex;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-20.0,10.0});
+		m_hSabreTheta14Nex = BookHistogram2D({"sabreTheta_14Nex","sabreTheta_14Nex;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-20.0,10.0});
+		m_hSabrePhi5Liex = BookHistogram2D({"sabrePhi_5Liex","sabrePhi_5Liex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-5.0,25.0});
+		m_hSabrePhi7Beex = BookHistogram2D({"sabrePhi_7Beex","sabrePhi_7Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hSabrePhi14Nex = BookHistogram2D({"sabrePhi_14Nex","sabrePhi_14Nex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hSabreESabreThetaNub = BookHistogram2D({"sabreE_sabreTheta_nub","sabreE_sabreTheta_nub;#theta (deg);E(MeV)",180,0.0,180.0,400,0.0,20.0});
+		m_hSabreESabrePhiNub = BookHistogram2D({"sabreE_sabrePhi_nub","sabreE_sabreTheta_nub;#phi (deg);E(MeV)",360,0.0,360.0,400,0.0,20.0});
+		m_hSabreTheta5LiexNabinPeak = BookHistogram2D({"sabreTheta_5Liex_nabinPeak","sabreTheta_5Liex_nabinPeak;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-5.0,25.0});
+		m_hSabreTheta7BeexNabinPeak = BookHistogram2D({"sabreTheta_7Beex_nabinPeak","sabreTheta_7Beex_nabinPeak;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-20.0,10.0});
+		m_hSabrePhi5LiexNabinPeak = BookHistogram2D({"sabrePhi_5Liex_nabinPeak","sabrePhi_5Liex_nabinPeak;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-5.0,25.0});
+		m_hSabrePhi7BeexNabinPeak = BookHistogram2D({"sabrePhi_7Beex_nabinPeak","sabrePhi_7Beex_nabinPeak;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hXavgGated5Ligs = BookHistogram1D({"xavg_gated5Ligs","xavg_gated5Ligs;xavg;counts",600,-300.0,300.0});
+		m_hXavgGated8Begs = BookHistogram1D({"xavg_gated8Begs","xavg_gated8Begs;xavg;counts",600,-300.0,300.0});
+		m_hXavgGated7Begs = BookHistogram1D({"xavg_gated7Begs","xavg_gated7Begs;xavg;counts",600,-300.0,300.0});
+		m_hXavgSabreE7Begs = BookHistogram2D({"xavg_sabreE_7Begs","xavg_sabreE_7Begs;xavg;E(MeV)",600,-300.0,300.0,400,0.0,20.0});
+		m_hXavgGated7BegsReject14Ngs = BookHistogram1D({"xavg_gated7Begs_reject14Ngs","xavg_gated7Begs_reject14Ngs;xavg;counts",600, -300.0, 300.0});
+		m_hSabreESabreTheta7begsNub = BookHistogram2D({"sabreE_sabreTheta_7begs_nub","sabreE_sabreTheta_7begs_nub;#theta (deg);E(MeV)",180,0.0,180.0,400,0.0,20.0});
+		m_hSabreESabrePhi7begsNub = BookHistogram2D({"sabreE_sabrePhi_7begs_nub","sabreE_sabreTheta_7begs_nub;#phi (deg);E(MeV)",360,0.0,360.0,400,0.0,20.0});
+		m_hXavgGated14Ngs = BookHistogram1D({"xavg_gated14Ngs","xavg_gated14Ngs;xavg;counts",600,-300.0,300.0});
+		m_hXavgNotGatedAllChannels = BookHistogram1D({"xavg_notGatedAllChannels","xavg_notGatedAllChannels;xavg;counts",600,-300.0,300.0});
+		//RunDegradedSabre
+		m_hSabreCountsGatedDegraderDets = BookHistogram1D({"sabre_counts_gated_degraderDets","sabre_counts_gated;number per event;counts",10,-1.0, 9.0});
+		m_hIncidentAngle = BookHistogram1D({"incidentAngle","incidentAngle;#theta_inc;counts",180,0.0,180.0});
+		m_hEx5LiDegDets = BookHistogram1D({"ex_5Li_degDets","ex_5Li;E_x(MeV);counts",3000,-5.0,25.0});
+		m_hEx7BeDegDets = BookHistogram1D({"ex_7Be_degDets","ex_5Li;E_x(MeV);counts",3000,-5.0,25.0});
+		m_hEx8beDegdDets = BookHistogram1D({"ex_8be_degdDets","ex_8be_degDets; E_x(MeV); counts",3000,-5.0,25.0});
+		m_hXavgEx8beDegDets = BookHistogram2D({"xavg_ex8be_degDets","xavg_ex8be_degDets;xavg;E_x(MeV)",600,-300.0,300.0,300,-5.0,25.0});
+		m_hEx8beDegradedPunched = BookHistogram1D({"ex_8be_degradedPunched","ex_8be_degradedPunched; E_x(MeV); counts",300,-10.0,20.0});
+		m_hEx8beDegraded = BookHistogram1D({"ex_8be_degraded","ex_8be_degraded; E_x(MeV); counts",300,-10.0,20.0});
+		m_hEx8beDegradedPunched04 = BookHistogram1D({"ex_8be_degradedPunched04","ex_8be_degradedPunched04; E_x(MeV); counts",300,-10.0,20.0});
+		m_hEx8beDegraded04 = BookHistogram1D({"ex_8be_degraded04","ex_8be_degraded04; E_x(MeV); counts",300,-10.0,20.0});
+		m_hXavgEx8beDegradedPunched = BookHistogram2D({"xavg_ex8be_degradedPunched","xavg_ex8be_degradedPunched;xavg;E_x(MeV)",600,-300.0,300.0,300,-10.0,20.0});
+		m_hXavgEx8beDegraded = BookHistogram2D({"xavg_ex8be_degraded","xavg_ex8be_degraded;xavg;E_x(MeV)",600,-300.0,300.0,300,-10.0,20.0});
+		m_hSabrePhi5LiexDegDets = BookHistogram2D({"sabrePhi_5Liex_degDets","sabrePhi_5Liex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-5.0,25.0});
+		m_hSabreTheta5LiexDegDets = BookHistogram2D({"sabreTheta_5Liex_degDets","sabreTheta_5Liex;#theta (deg);E_x (MeV)",360,0.0,360.0,1000,-5.0,25.0});
+		m_hSabrePhi8BeexDegDets = BookHistogram2D({"sabrePhi_8Beex_degDets","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hSabreTheta8BeexDegDets = BookHistogram2D({"sabreTheta_8Beex_degDets","sabreTheta_8Beex;#theta (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hSabrePhi8BeexDegradedPunched = BookHistogram2D({"sabrePhi_8Beex_degradedPunched","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hSabreTheta8BeexDegradedPunched = BookHistogram2D({"sabreTheta_8Beex_degradedPunched","sabreTheta_8Beex;#theta (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hSabrePhi8BeexDegraded = BookHistogram2D({"sabrePhi_8Beex_degraded","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hSabreTheta8BeexDegraded = BookHistogram2D({"sabreTheta_8Beex_degraded","sabreTheta_8Beex;#theta (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hRelAngleRecovSabreKE8bePunchRecon = BookHistogram2D({"relAngle_recovSabreKE_8bePunchRecon","relAngle_recovSabreKe;#theta_{rel}(deg);Recovered KE (MeV)",180,0.0,180.0,400,0.0,20.0});
+		m_hRelAngleSabreKEDegDets = BookHistogram2D({"relAngle_sabreKE_degDets","relAngle_sabreKE_degDets;#theta_{rel};SABRE E(Mev)",180,0.0,180.0,400,0.0,20.0});
+		m_hRelAngleSabreKEDegraded = BookHistogram2D({"relAngle_sabreKE_degraded","relAngle_sabreKE_degraded;#theta_{rel};SABRE E(Mev)",180,0.0,180.0,400,0.0,20.0});
+		m_hRelAngleSabreKEDegradedPunched = BookHistogram2D({"relAngle_sabreKE_degradedPunched","relAngle_sabreKE_degradedPunched;#theta_{rel};SABRE E(Mev)",180,0.0,180.0,400,0.0,20.0});
+		m_hXavgGated8be1exDegDets = BookHistogram1D({"xavg_gated_8be1ex_degDets","xavg_gated_8be1ex_degDets;xavg;counts",600,-300.0,300.0});
+		m_hXavgGated7BegsDegDets = BookHistogram1D({"xavg_gated7Begs_degDets","xavg_gated7Begs_degDets;xavg;counts",600,-300.0,300.0});
+		m_hXavgGated8begsDegraded = BookHistogram1D({"xavg_gated_8begs_degraded","xavg_gated_8begs_degraded;xavg;counts",600,-300,300});
+		m_hXavgGated8begsRecoveredSum = BookHistogram1D({"xavg_gated_8begs_recoveredSum","xavg_gated_8begs_recoveredSum;xavg;counts",600,-300,300});
+		m_hXavgGated8be1exDegraded = BookHistogram1D({"xavg_gated_8be1ex_degraded","xavg_gated_8be1ex_degraded;xavg;counts",600,-300,300});
+		m_hXavgGated8be1exRecoveredSum = BookHistogram1D({"xavg_gated_8be1ex_recoveredSum","xavg_gated_8be1ex_recoveredSum;xavg;counts",600,-300,300});
+		m_hXavgGated8begsDegradedPunched = BookHistogram1D({"xavg_gated_8begs_degradedPunched","xavg_gated_8begs_degradedPunched;xavg;counts",600,-300,300});
+		m_hXavgGated8be1exDegradedPunched = BookHistogram1D({"xavg_gated_8be1ex_degradedPunched","xavg_gated_8be1ex_degradedPunched;xavg;counts",600,-300,300});
+		m_hXavgGated8be1exDegradedPunched04 = BookHistogram1D({"xavg_gated_8be1ex_degradedPunched_04","xavg_gated_8be1ex_degradedPunched_04;xavg;counts",600,-300,300});
+		m_hXavgGated8be1exDegradedPunchedRejectEdge = BookHistogram1D({"xavg_gated_8be1ex_degradedPunched_rejectEdge","xavg_gated_8be1ex_degradedPunched_rejectEdge;xavg;counts",600,-300,300});
+		m_hXavgGated8be1exRecoveredSumRejectEdge = BookHistogram1D({"xavg_gated_8be1ex_recoveredSum_rejectEdge","xavg_gated_8be1ex_recoveredSum_rejectEdge;xavg;counts",600,-300,300});
+		m_hXavgGated8be1exDegradedPunchedRejectEdge04 = BookHistogram1D({"xavg_gated_8be1ex_degradedPunched_rejectEdge_04","xavg_gated_8be1ex_degradedPunched_rejectEdge_04;xavg;counts",600,-300,300});
+		m_hEx8beDegradedPunchedRejectPrev = BookHistogram1D({"ex_8be_degradedPunched_rejectPrev","ex_8be_degradedPunched_rejectPrev;E_x(MeV);counts",300,-10.0,20.0});
+		m_hSabrePhi8BeexDegradedPunchedRejectPrev = BookHistogram2D({"sabrePhi_8Beex_degradedPunched_rejectPrev","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hXavgEx8beDegradedPunchedRejectPrev = BookHistogram2D({"xavg_ex8be_degradedPunched_rejectPrev","xavg_ex8be_degradedPunched;xavg;E_x(MeV)",600,-300.0,300.0,300,-10.0,20.0});
+		m_hXavgGated8beexLowDegradedPunched = BookHistogram1D({"xavg_gated_8beex_low_degradedPunched","xavg_gated_8beex_low_degradedPunched;xavg;counts",600,-300.0,300.0});
+		m_hEx8beDegradedPunched04RejectPrev = BookHistogram1D({"ex_8be_degradedPunched04_rejectPrev","ex_8be_degradedPunched04_rejectPrev; E_x(MeV); counts",300,-10.0,20.0});
+		m_hEx8beDegraded04RejectPrev = BookHistogram1D({"ex_8be_degraded04_rejectPrev","ex_8be_degraded04_rejectPrev; E_x(MeV); counts",300,-10.0,20.0});
+		m_hXavgGated8beexLowDegraded = BookHistogram1D({"xavg_gated_8beex_low_degraded","xavg_gated_8beex_low_degraded;xavg;counts",600,-300.0,300.0});
+		m_hSabreESabreThetaDegDets = BookHistogram2D({"sabreE_sabreTheta_degDets","sabreE_sabreTheta_degDets;#theta (deg);E(MeV)",180,0.0,180.0,400,0.0,20.0});
+		m_hXavgSabreEDegDets = BookHistogram2D({"xavg_sabreE_degDets","xavg_sabreE_degDets;xavg;E(MeV)", 600,0.-300.0,300.0,400,0.0,20.0});
+		m_h9BthetaSabreThetaDegDets = BookHistogram2D({"9Btheta_sabreTheta_degDets","9Btheta_sabreTheta_degDets;#theta_{9B};#theta_{SABRE}",180,0.0,180.0,180,0.0,180.0});
+		m_hSabreERelAngleDegDets = BookHistogram2D({"sabreE_relAngle_degDets","sabreE_relAngle_degDets;#theta_{rel};E(MeV)",180,0.0,180.0,400,0.0,20.0});
+		m_hSabreESabreThetaDegDetsRejectEdge = BookHistogram2D({"sabreE_sabreTheta_degDets_rejectEdge","sabreE_sabreTheta_degDets;#theta (deg);E(MeV)",180,0.0,180.0,400,0.0,20.0});
+		m_hXavgSabreEDegDetsRejectEdge = BookHistogram2D({"xavg_sabreE_degDets_rejectEdge","xavg_sabreE_degDets;xavg;E(MeV)",600,0.-300.0,300.0,400,0.0,20.0});
+		m_hXavgDegDetsRejectEdge = BookHistogram1D({"xavg_degDets_rejectEdge","xavg_degDets_rejectEdge;xavg",600,-300.0,300.0});
+		m_h9BthetaSabreThetaDegDetsRejectEdge = BookHistogram2D({"9Btheta_sabreTheta_degDets_rejectEdge","9Btheta_sabreTheta_degDets_rejectEdge;#theta_{9B};#theta_{SABRE}",180,0.0,180.0,180,0.0,180.0});
+		m_hSabreERelAngleDegDetsRejectEdge = BookHistogram2D({"sabreE_relAngle_degDets_rejectEdge","sabreE_relAngle_degDets_rejectEdge;#theta_{rel};E(MeV)",180,0.0,180.0,400,0.0,20.0});
+		m_hEx8beDegradedPunchedRejectPrevRejectEdge = BookHistogram1D({"ex_8be_degradedPunched_rejectPrev_rejectEdge","ex_8be_degradedPunched_rejectPrev;E_x(MeV);counts",300,-10.0,20.0});
+		m_hSabrePhi8BeexDegradedPunchedRejectPrevRejectEdge = BookHistogram2D({"sabrePhi_8Beex_degradedPunched_rejectPrev_rejectEdge","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0});
+		m_hXavgEx8beDegradedPunchedRejectPrevRejectEdge = BookHistogram2D({"xavg_ex8be_degradedPunched_rejectPrev_rejectEdge","xavg_ex8be_degradedPunched;xavg;E_x(MeV)",600,-300.0,300.0,300,-10.0,20.0});
+		m_hXavgGated8beexLowDegradedPunchedRejectEdge = BookHistogram1D({"xavg_gated_8beex_low_degradedPunched_rejectEdge","xavg_gated_8beex_low_degradedPunched;xavg;counts",600,-300.0,300.0});
+		m_hXavgGated8beexLowDegradedRejectEdge = BookHistogram1D({"xavg_gated_8beex_low_degraded_rejectEdge","xavg_gated_8beex_low_degraded;xavg;counts",600,-300.0,300.0});
+		for(int i=0; i<s_nSabreDetectors; i++)
 		{
-			h = std::make_shared<TH2F>(params.name.c_str(), params.title.c_str(), params.binsX, params.minX, params.maxX, params.binsY, params.minY, params.maxY);
-			h->Fill(valueX, valueY);
-			m_histoMap[params.name] = h;
+			m_hEx8beDegradedPunchedDet[i] = BookHistogram1D({"ex_8be_degradedPunched"+std::to_string(i),"ex_8be_degradedPunched; E_x(MeV); counts",300,-10.0,20.0});
+			m_hEx8beDegradedDet[i] = BookHistogram1D({"ex_8be_degraded"+std::to_string(i),"ex_8be_degraded; E_x(MeV); counts",300,-10.0,20.0});
 		}
 	}
 
-
 	void Histogrammer::Run()
 	{
 		if(!m_isValid)
@@ -252,9 +487,11 @@ namespace SabreRecon {
 		float flush_frac = 0.01f;
 		uint64_t count = 0, flush_count = 0, flush_val = nevents*flush_frac;
 
+		RandomGenerator& generator = RandomGenerator::GetInstance();
 		for(uint64_t i=0; i<nevents; i++)
 		{
 			tree->GetEntry(i);
+			generator.SetEntry(i);
 			count++;
 			if(count == flush_val)
 			{
@@ -267,11 +504,11 @@ namespace SabreRecon {
 			if(m_cuts.IsInside())
 			{
 				
-				FillHistogram1D({"xavg_gated","xavg_gated;xavg;counts",600,-300.0,300.0}, m_eventPtr->xavg);
+				FillHistogram1D(m_hXavgGated, m_eventPtr->xavg);
 				
 				if(!m_eventPtr->sabre.empty() && m_eventPtr->sabre[0].ringE > s_weakSabreThreshold)
 				{
-					FillHistogram1D({"sabre_counts_gated","sabre_counts_gated;number per event;counts",10,-1.0, 9.0}, m_eventPtr->sabre.size());
+					FillHistogram1D(m_hSabreCountsGated, m_eventPtr->sabre.size());
 					if(m_eventPtr->sabre[0].detID == 0 || m_eventPtr->sabre[0].detID == 1 || m_eventPtr->sabre[0].detID == 4)
 					{
 						RunDegradedSabre(m_eventPtr->sabre[0]);
@@ -280,241 +517,323 @@ namespace SabreRecon {
 					{
 						RunSabre(m_eventPtr->sabre[0]);
 					}
-					/*
-					if(m_eventPtr->sabre.size() > 1 && m_eventPtr->sabre[1].ringE > s_weakSabreThreshold &&
-					   (m_eventPtr->sabre[1].detID == 0 || m_eventPtr->sabre[1].detID == 1 || m_eventPtr->sabre[1].detID == 4)
-					  )
-					{
-						//Attemp to find some maybe double stuff?
-						RunDegradedSabre(m_eventPtr->sabre[1]);
-					}
-					*/
+					if(m_eventPtr->sabre.size() > 1)
+						RunBreakups();
 				}
 			}	
 		}
 		std::cout<<std::endl;
+		PrintBreakupStatistics("8Be -> 2a", m_breakupStats8Be);
+		PrintBreakupStatistics("12C -> 3a", m_breakupStats12C);
+		PrintTableAccuracy();
+		if(m_nValidatedEvents > 0)
+		{
+			std::cout<<"Fast precision validation over "<<m_nValidatedEvents<<" SABRE events -- excitation deviation from exact max: "
+					 <<m_precisionDeviation.maxDeviation*1000.0<<" keV RMS: "<<m_precisionDeviation.GetRMS()*1000.0<<" keV over "
+					 <<m_precisionDeviation.nCompared<<" results, "<<m_precisionDeviation.nMismatched<<" results valid in only one tier"<<std::endl;
+		}
 		input->Close();
 		output->cd();
-		for(auto& gram : m_histoMap)
-			gram.second->Write(gram.second->GetName(), TObject::kOverwrite);
+		for(auto& booked : m_histograms1D)
+		{
+			if(booked.histogram)
+				booked.histogram->Write(booked.histogram->GetName(), TObject::kOverwrite);
+		}
+		for(auto& booked : m_histograms2D)
+		{
+			if(booked.histogram)
+				booked.histogram->Write(booked.histogram->GetName(), TObject::kOverwrite);
+		}
 		output->Close();
 	}
 
+	/*
+		Every pair/triple of SABRE hits over threshold passing the prefilters, as a breakup of 8Be/12C. The hits are smeared
+		after those of RunSabre/RunDegradedSabre, so adding the breakups leaves the single-hit results unchanged.
+	*/
+	void Histogrammer::RunBreakups()
+	{
+		std::size_t nCandidates = m_recon.RunBreakup(m_eventPtr->sabre.data(), m_eventPtr->sabre.size(), m_breakup8Be, m_breakupCuts8Be,
+													 m_breakupCandidates, s_maxBreakupCandidates, m_breakupStats8Be, m_workspace);
+		if(nCandidates > 0)
+			FillHistogram1D(m_hBreakup8BeCandidates, nCandidates);
+		for(std::size_t i=0; i<nCandidates; i++)
+		{
+			const ReconResult& result = m_breakupCandidates[i].result;
+			FillHistogram1D(m_hEx8Be2a, result.excitation);
+			FillHistogram2D(m_hSumKEEx8Be2a, result.excitation, result.sabreRxnKE);
+		}
+
+		if(m_eventPtr->sabre.size() < 3)
+			return;
+		nCandidates = m_recon.RunBreakup(m_eventPtr->sabre.data(), m_eventPtr->sabre.size(), m_breakup12C, m_breakupCuts12C,
+										 m_breakupCandidates, s_maxBreakupCandidates, m_breakupStats12C, m_workspace);
+		if(nCandidates > 0)
+			FillHistogram1D(m_hBreakup12CCandidates, nCandidates);
+		for(std::size_t i=0; i<nCandidates; i++)
+		{
+			const ReconResult& result = m_breakupCandidates[i].result;
+			FillHistogram1D(m_hEx12C3a, result.excitation);
+			FillHistogram2D(m_hSumKEEx12C3a, result.excitation, result.sabreRxnKE);
+		}
+	}
+
+	void Histogrammer::PrintBreakupStatistics(const std::string& name, const BreakupStatistics& stats) const
+	{
+		if(stats.nEvents == 0)
+			return;
+		std::cout<<name<<" breakups -- events: "<<stats.nEvents<<" (truncated: "<<stats.nTruncated<<") combinations: "<<stats.nCombinations
+				 <<" rejected by detectors: "<<stats.nRejectedDetectors<<" energy: "<<stats.nRejectedEnergy<<" angle: "<<stats.nRejectedAngle
+				 <<" energy corrections: "<<stats.nCorrections<<" candidates: "<<stats.nCandidates<<std::endl;
+	}
+
+	void Histogrammer::PrintTableAccuracy() const
+	{
+		for(auto& table : m_recon.GetTableAccuracy())
+		{
+			std::cout<<"Table "<<table.name<<" -- deviation from exact max: "<<table.maxDeviation*1000.0<<" keV ("<<table.maxRelDeviation*100.0
+					 <<"%) rms: "<<table.GetRMSRelDeviation()*100.0<<"% over "<<table.nSamples<<" samples"<<std::endl;
+		}
+	}
+
+	/*
+		While the validation sample is not full, rerun the hypotheses of a fast tier SABRE hit with the exact tier. The entry's
+		draws are restarted so both tiers see the same smearing.
+	*/
+	void Histogrammer::ValidatePrecision(const SabrePair& pair, const ReconHypothesis* hypotheses, const ReconResult* results, std::size_t n)
+	{
+		static ReconResult exactResults[std::max(s_nSabreHypotheses, s_nDegradedHypotheses)];
+		if(m_precision != ReconPrecision::Fast || m_nValidatedEvents >= m_nValidationEvents)
+			return;
+
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		generator.SetEntry(generator.GetEntry());
+		m_recon.RunHypotheses(m_eventPtr->xavg, pair, hypotheses, exactResults, n, m_workspace, ReconPrecision::Exact);
+		for(std::size_t i=0; i<n; i++)
+			m_precisionDeviation.Add(results[i], exactResults[i]);
+		m_nValidatedEvents++;
+	}
+
 	void Histogrammer::RunSabre(const SabrePair& pair)
 	{
-		static ReconResult recon5Li, recon7Be, recon8Be, recon14N, recon9B;
+		static ReconResult results[s_nSabreHypotheses];
 		static TVector3 sabreCoords, b9Coords;
 		static double relAngle;
 
-		recon9B = m_recon.RunFPResidExcitation(m_eventPtr->xavg, m_beamKE, {{5,10},{2,3},{3,4}});
-		recon5Li = m_recon.RunSabreExcitation(m_eventPtr->xavg, m_beamKE, pair, {{5,10},{2,3},{2,4},{2,4}});
-		recon8Be = m_recon.RunSabreExcitation(m_eventPtr->xavg, m_beamKE, pair, {{5,10},{2,3},{2,4},{1,1}});
-		recon7Be = m_recon.RunSabreExcitation(m_eventPtr->xavg, m_beamKE, pair, {{5,10},{2,3},{2,4},{1,2}});
-		recon14N = m_recon.RunSabreExcitation(m_eventPtr->xavg, m_beamKE, pair, {{8,16},{2,3},{2,4},{1,1}});
-		sabreCoords = m_recon.GetSabreCoordinates(pair);
+		sabreCoords = ToTVector3(m_recon.RunHypotheses(m_eventPtr->xavg, pair, m_sabreHypotheses, results, s_nSabreHypotheses, m_workspace));
+		ValidatePrecision(pair, m_sabreHypotheses, results, s_nSabreHypotheses);
+		const ReconResult& recon9B = results[0];
+		const ReconResult& recon5Li = results[1];
+		const ReconResult& recon8Be = results[2];
+		const ReconResult& recon7Be = results[3];
+		const ReconResult& recon14N = results[4];
 		b9Coords.SetMagThetaPhi(1.0, recon9B.residThetaLab, recon9B.residPhiLab);
 		relAngle = std::acos(b9Coords.Dot(sabreCoords)/(sabreCoords.Mag()*b9Coords.Mag()));
 
-		FillHistogram1D({"xavg_gated_sabre","xavg_gated_sabre;xavg;counts",600,-300.0,300.0}, m_eventPtr->xavg);
-		FillHistogram2D({"scintE_cathodeE","scintE_cathodeE;scintE;cathodeE",512,0,4096,512,0,4096}, m_eventPtr->scintE, m_eventPtr->cathodeE);
-		FillHistogram2D({"xavg_theta","xavg_theta;xavg;theta",600,-300.0,300.0,500,0.0,1.5}, m_eventPtr->xavg, m_eventPtr->theta);
-
-		FillHistogram1D({"ex_5Li", "ex_5Li;E_x(MeV);counts",3000,-5.0,25.0}, recon5Li.excitation);
-		FillHistogram1D({"ex_7Be", "ex_7Be;E_x(MeV);counts",3000,-20.0,10.0}, recon7Be.excitation);
-		FillHistogram1D({"ex_8Be", "ex_8Be;E_x(MeV);counts",3000,-5.0,25.0}, recon8Be.excitation);
-		FillHistogram1D({"ex_14N", "ex_14N;E_x(MeV);counts",3000,-20.0,10.0}, recon14N.excitation);
-		FillHistogram2D({"ex_14N_7Be","ex_14N_7Be;E_x 14N;E_x 7Be",500,-10.0,10.0,500,-10.,10.0}, recon14N.excitation, recon7Be.excitation);
-		FillHistogram2D({"sabreTheta_sabreE","sabreTheta_sabreE;#theta (deg); E(MeV)",180,0,180,400,0,20.0},sabreCoords.Theta()*s_rad2deg, pair.ringE);
-		FillHistogram2D({"xavg_sabreE","xavg_sabreE;xavg; E(MeV)",600,-300.0,300.0,400,0,20.0},m_eventPtr->xavg, pair.ringE);
-		FillHistogram2D({"9Btheta_sabreTheta","9Btheta_sabreTheta;#theta_{9B};#theta_{SABRE}",180,0.0,180.0,180,0.0,180.0}, recon9B.residThetaLab*s_rad2deg, sabreCoords.Theta()*s_rad2deg);
-		FillHistogram2D({"sabreE_relAngle","sabreE_relAngle;#theta_{rel};E(MeV)",180,0.0,180.0,400,0.0,20.0},relAngle*s_rad2deg,pair.ringE);
-		FillHistogram2D({"sabreTheta_5Liex","sabreTheta_5Liex;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-5.0,25.0},sabreCoords.Theta()*s_rad2deg,recon5Li.excitation);
-		FillHistogram2D({"sabreTheta_7Beex","sabreTheta_7Beex;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-20.0,10.0},sabreCoords.Theta()*s_rad2deg,recon7Be.excitation);
-		FillHistogram2D({"sabreTheta_14Nex","sabreTheta_14Nex;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-20.0,10.0},sabreCoords.Theta()*s_rad2deg,recon14N.excitation);
-		FillHistogram2D({"sabrePhi_5Liex","sabrePhi_5Liex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-5.0,25.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon5Li.excitation);
-		FillHistogram2D({"sabrePhi_7Beex","sabrePhi_7Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon7Be.excitation);
-		FillHistogram2D({"sabrePhi_14Nex","sabrePhi_14Nex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon14N.excitation);
+		FillHistogram1D(m_hXavgGatedSabre, m_eventPtr->xavg);
+		FillHistogram2D(m_hScintECathodeE, m_eventPtr->scintE, m_eventPtr->cathodeE);
+		FillHistogram2D(m_hXavgTheta, m_eventPtr->xavg, m_eventPtr->theta);
+
+		FillHistogram1D(m_hEx5Li, recon5Li.excitation);
+		FillHistogram1D(m_hEx7Be, recon7Be.excitation);
+		FillHistogram1D(m_hEx8Be, recon8Be.excitation);
+		FillHistogram1D(m_hEx14N, recon14N.excitation);
+		FillHistogram2D(m_hEx14N7Be, recon14N.excitation, recon7Be.excitation);
+		FillHistogram2D(m_hSabreThetaSabreE,sabreCoords.Theta()*s_rad2deg, pair.ringE);
+		FillHistogram2D(m_hXavgSabreE,m_eventPtr->xavg, pair.ringE);
+		FillHistogram2D(m_h9BthetaSabreTheta, recon9B.residThetaLab*s_rad2deg, sabreCoords.Theta()*s_rad2deg);
+		FillHistogram2D(m_hSabreERelAngle,relAngle*s_rad2deg,pair.ringE);
+		FillHistogram2D(m_hSabreTheta5Liex,sabreCoords.Theta()*s_rad2deg,recon5Li.excitation);
+		FillHistogram2D(m_hSabreTheta7Beex,sabreCoords.Theta()*s_rad2deg,recon7Be.excitation);
+		FillHistogram2D(m_hSabreTheta14Nex,sabreCoords.Theta()*s_rad2deg,recon14N.excitation);
+		FillHistogram2D(m_hSabrePhi5Liex,Phi360(sabreCoords.Phi())*s_rad2deg,recon5Li.excitation);
+		FillHistogram2D(m_hSabrePhi7Beex,Phi360(sabreCoords.Phi())*s_rad2deg,recon7Be.excitation);
+		FillHistogram2D(m_hSabrePhi14Nex,Phi360(sabreCoords.Phi())*s_rad2deg,recon14N.excitation);
 
 		if(m_eventPtr->xavg > -186.0 && m_eventPtr->xavg < -178.0) //nub
 		{
-			FillHistogram2D({"sabreE_sabreTheta_nub","sabreE_sabreTheta_nub;#theta (deg);E(MeV)",180,0.0,180.0,400,0.0,20.0},sabreCoords.Theta()*s_rad2deg,pair.ringE);
-			FillHistogram2D({"sabreE_sabrePhi_nub","sabreE_sabreTheta_nub;#phi (deg);E(MeV)",360,0.0,360.0,400,0.0,20.0},Phi360(sabreCoords.Phi())*s_rad2deg,pair.ringE);
+			FillHistogram2D(m_hSabreESabreThetaNub,sabreCoords.Theta()*s_rad2deg,pair.ringE);
+			FillHistogram2D(m_hSabreESabrePhiNub,Phi360(sabreCoords.Phi())*s_rad2deg,pair.ringE);
 		}
 		else if(m_eventPtr->xavg > -195.0 && m_eventPtr->xavg < -185.0) //Nabin peak
 		{
-			FillHistogram2D({"sabreTheta_5Liex_nabinPeak","sabreTheta_5Liex_nabinPeak;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-5.0,25.0},sabreCoords.Theta()*s_rad2deg,recon5Li.excitation);
-			FillHistogram2D({"sabreTheta_7Beex_nabinPeak","sabreTheta_7Beex_nabinPeak;#theta (deg);E_x (MeV)",180,0.0,180.0,1000,-20.0,10.0},sabreCoords.Theta()*s_rad2deg,recon7Be.excitation);
-			FillHistogram2D({"sabrePhi_5Liex_nabinPeak","sabrePhi_5Liex_nabinPeak;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-5.0,25.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon5Li.excitation);
-			FillHistogram2D({"sabrePhi_7Beex_nabinPeak","sabrePhi_7Beex_nabinPeak;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon7Be.excitation);
+			FillHistogram2D(m_hSabreTheta5LiexNabinPeak,sabreCoords.Theta()*s_rad2deg,recon5Li.excitation);
+			FillHistogram2D(m_hSabreTheta7BeexNabinPeak,sabreCoords.Theta()*s_rad2deg,recon7Be.excitation);
+			FillHistogram2D(m_hSabrePhi5LiexNabinPeak,Phi360(sabreCoords.Phi())*s_rad2deg,recon5Li.excitation);
+			FillHistogram2D(m_hSabrePhi7BeexNabinPeak,Phi360(sabreCoords.Phi())*s_rad2deg,recon7Be.excitation);
 		}
 
 		//Gate on reconstr. excitation structures; overlaping cases are possible!
 		if(recon5Li.excitation > -2.0 && recon5Li.excitation < 2.0)
 		{
-			FillHistogram1D({"xavg_gated5Ligs", "xavg_gated5Ligs;xavg;counts",600,-300.0,300.0}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated5Ligs, m_eventPtr->xavg);
 		}
 		if(recon8Be.excitation > -0.1 && recon8Be.excitation < 0.1)
 		{
-			FillHistogram1D({"xavg_gated8Begs", "xavg_gated8Begs;xavg;counts",600,-300.0,300.0}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8Begs, m_eventPtr->xavg);
 		}
 		if(recon7Be.excitation > -0.1 && recon7Be.excitation < 0.15)
 		{
-			FillHistogram1D({"xavg_gated7Begs", "xavg_gated7Begs;xavg;counts",600,-300.0,300.0}, m_eventPtr->xavg);
-			FillHistogram2D({"xavg_sabreE_7Begs","xavg_sabreE_7Begs;xavg;E(MeV)",600,-300.0,300.0,400,0.0,20.0}, m_eventPtr->xavg, pair.ringE);
+			FillHistogram1D(m_hXavgGated7Begs, m_eventPtr->xavg);
+			FillHistogram2D(m_hXavgSabreE7Begs, m_eventPtr->xavg, pair.ringE);
 			if(!(recon14N.excitation > -0.1 && recon14N.excitation < 2.0))
-				FillHistogram1D({"xavg_gated7Begs_reject14Ngs", "xavg_gated7Begs_reject14Ngs;xavg;counts",600, -300.0, 300.0}, m_eventPtr->xavg);
+				FillHistogram1D(m_hXavgGated7BegsReject14Ngs, m_eventPtr->xavg);
 			if(m_eventPtr->xavg > -186.0 && m_eventPtr->xavg < -178.0)
 			{
-				FillHistogram2D({"sabreE_sabreTheta_7begs_nub","sabreE_sabreTheta_7begs_nub;#theta (deg);E(MeV)",180,0.0,180.0,400,0.0,20.0},sabreCoords.Theta()*s_rad2deg,pair.ringE);
-				FillHistogram2D({"sabreE_sabrePhi_7begs_nub","sabreE_sabreTheta_7begs_nub;#phi (deg);E(MeV)",360,0.0,360.0,400,0.0,20.0},Phi360(sabreCoords.Phi())*s_rad2deg,pair.ringE);
+				FillHistogram2D(m_hSabreESabreTheta7begsNub,sabreCoords.Theta()*s_rad2deg,pair.ringE);
+				FillHistogram2D(m_hSabreESabrePhi7begsNub,Phi360(sabreCoords.Phi())*s_rad2deg,pair.ringE);
 			}
 		}
 		if(recon14N.excitation > -0.1 && recon14N.excitation < 0.2)
 		{
-			FillHistogram1D({"xavg_gated14Ngs", "xavg_gated14Ngs;xavg;counts",600,-300.0,300.0}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated14Ngs, m_eventPtr->xavg);
 		}
 		if(!(recon14N.excitation > -0.1 && recon14N.excitation < 0.2) && !(recon7Be.excitation > -0.1 && recon7Be.excitation < 0.15)
 			&& !(recon8Be.excitation > -0.1 && recon8Be.excitation < 0.1) && !(recon5Li.excitation > -2.0 && recon5Li.excitation < 2.0))
 		{
-			FillHistogram1D({"xavg_notGatedAllChannels", "xavg_notGatedAllChannels;xavg;counts",600,-300.0,300.0}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgNotGatedAllChannels, m_eventPtr->xavg);
 		}
 	}
 
 	void Histogrammer::RunDegradedSabre(const SabrePair& pair)
 	{
-		static ReconResult recon8Be, recon8BeDegrade, recon8BePunch, recon9B, recon5Li, recon7Be;
+		static ReconResult results[s_nDegradedHypotheses];
 		static TVector3 sabreCoords, b9Coords, sabreNorm;
 		static double relAngle, incidentAngle;
 
-		FillHistogram1D({"sabre_counts_gated_degraderDets","sabre_counts_gated;number per event;counts",10,-1.0, 9.0}, m_eventPtr->sabre.size());
+		FillHistogram1D(m_hSabreCountsGatedDegraderDets, m_eventPtr->sabre.size());
 
-		recon5Li = m_recon.RunSabreExcitation(m_eventPtr->xavg, m_beamKE, pair, {{5,10},{2,3},{2,4},{2,4}});
-		recon7Be = m_recon.RunSabreExcitation(m_eventPtr->xavg, m_beamKE, pair, {{5,10},{2,3},{2,4},{1,2}});
-		recon8Be = m_recon.RunSabreExcitation(m_eventPtr->xavg, m_beamKE, pair, {{5,10},{2,3},{2,4},{1,1}});
-		recon8BeDegrade = m_recon.RunSabreExcitationDegraded(m_eventPtr->xavg, m_beamKE, pair, {{5,10},{2,3},{2,4},{1,1}});
-		recon8BePunch = m_recon.RunSabreExcitationPunchDegraded(m_eventPtr->xavg, m_beamKE, pair, {{5,10},{2,3},{2,4},{1,1}});
-		recon9B = m_recon.RunFPResidExcitation(m_eventPtr->xavg, m_beamKE, {{5,10},{2,3},{3,4}});
-		sabreCoords = m_recon.GetSabreCoordinates(pair);
+		sabreCoords = ToTVector3(m_recon.RunHypotheses(m_eventPtr->xavg, pair, m_degradedHypotheses, results, s_nDegradedHypotheses, m_workspace));
+		ValidatePrecision(pair, m_degradedHypotheses, results, s_nDegradedHypotheses);
+		const ReconResult& recon9B = results[0];
+		const ReconResult& recon5Li = results[1];
+		const ReconResult& recon7Be = results[2];
+		const ReconResult& recon8Be = results[3];
+		const ReconResult& recon8BeDegrade = results[4];
+		const ReconResult& recon8BePunch = results[5];
 		b9Coords.SetMagThetaPhi(1.0, recon9B.residThetaLab, recon9B.residPhiLab);
-		sabreNorm = m_recon.GetSabreNorm(pair.detID);
+		sabreNorm = ToTVector3(m_recon.GetSabreNorm(pair.detID));
 		relAngle = std::acos(b9Coords.Dot(sabreCoords)/(sabreCoords.Mag()*b9Coords.Mag()));
 		incidentAngle = std::acos(sabreNorm.Dot(sabreCoords)/(sabreCoords.Mag()*sabreNorm.Mag()));
 		if(incidentAngle > M_PI/2.0)
 			incidentAngle = M_PI - incidentAngle;
 
-		FillHistogram1D({"incidentAngle","incidentAngle;#theta_inc;counts",180,0.0,180.0}, incidentAngle*s_rad2deg);
-		FillHistogram1D({"ex_5Li_degDets", "ex_5Li;E_x(MeV);counts",3000,-5.0,25.0}, recon5Li.excitation);
-		FillHistogram1D({"ex_7Be_degDets", "ex_5Li;E_x(MeV);counts",3000,-5.0,25.0}, recon7Be.excitation);
-		FillHistogram1D({"ex_8be_degdDets","ex_8be_degDets; E_x(MeV); counts",3000,-5.0,25.0}, recon8Be.excitation);
-		FillHistogram2D({"xavg_ex8be_degDets","xavg_ex8be_degDets;xavg;E_x(MeV)",600,-300.0,300.0,300,-5.0,25.0}, m_eventPtr->xavg, recon8Be.excitation);
-		FillHistogram1D({"ex_8be_degradedPunched","ex_8be_degradedPunched; E_x(MeV); counts",300,-10.0,20.0}, recon8BePunch.excitation);
-		FillHistogram1D({"ex_8be_degradedPunched"+std::to_string(pair.detID),"ex_8be_degradedPunched; E_x(MeV); counts",300,-10.0,20.0}, recon8BePunch.excitation);
-		FillHistogram1D({"ex_8be_degraded","ex_8be_degraded; E_x(MeV); counts",300,-10.0,20.0}, recon8BeDegrade.excitation);
-		FillHistogram1D({"ex_8be_degraded"+std::to_string(pair.detID),"ex_8be_degraded; E_x(MeV); counts",300,-10.0,20.0}, recon8BeDegrade.excitation);
+		FillHistogram1D(m_hIncidentAngle, incidentAngle*s_rad2deg);
+		FillHistogram1D(m_hEx5LiDegDets, recon5Li.excitation);
+		FillHistogram1D(m_hEx7BeDegDets, recon7Be.excitation);
+		FillHistogram1D(m_hEx8beDegdDets, recon8Be.excitation);
+		FillHistogram2D(m_hXavgEx8beDegDets, m_eventPtr->xavg, recon8Be.excitation);
+		FillHistogram1D(m_hEx8beDegradedPunched, recon8BePunch.excitation);
+		FillHistogram1D(m_hEx8beDegraded, recon8BeDegrade.excitation);
+		if(pair.detID >= 0 && pair.detID < s_nSabreDetectors) //a bad detID in the data only skips the per detector histograms
+		{
+			FillHistogram1D(m_hEx8beDegradedPunchedDet[pair.detID], recon8BePunch.excitation);
+			FillHistogram1D(m_hEx8beDegradedDet[pair.detID], recon8BeDegrade.excitation);
+		}
 		if(pair.detID == 0 || pair.detID == 4)
 		{
-			FillHistogram1D({"ex_8be_degradedPunched04","ex_8be_degradedPunched04; E_x(MeV); counts",300,-10.0,20.0}, recon8BePunch.excitation);
-			FillHistogram1D({"ex_8be_degraded04","ex_8be_degraded04; E_x(MeV); counts",300,-10.0,20.0}, recon8BeDegrade.excitation);
-		}
-		FillHistogram2D({"xavg_ex8be_degradedPunched","xavg_ex8be_degradedPunched;xavg;E_x(MeV)",600,-300.0,300.0,300,-10.0,20.0}, m_eventPtr->xavg, recon8BePunch.excitation);
-		FillHistogram2D({"xavg_ex8be_degraded","xavg_ex8be_degraded;xavg;E_x(MeV)",600,-300.0,300.0,300,-10.0,20.0}, m_eventPtr->xavg, recon8BeDegrade.excitation);
-		FillHistogram2D({"sabrePhi_5Liex_degDets","sabrePhi_5Liex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-5.0,25.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon5Li.excitation);
-		FillHistogram2D({"sabreTheta_5Liex_degDets","sabreTheta_5Liex;#theta (deg);E_x (MeV)",360,0.0,360.0,1000,-5.0,25.0},sabreCoords.Theta()*s_rad2deg,recon5Li.excitation);
-		FillHistogram2D({"sabrePhi_8Beex_degDets","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon8Be.excitation);
-		FillHistogram2D({"sabreTheta_8Beex_degDets","sabreTheta_8Beex;#theta (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},sabreCoords.Theta()*s_rad2deg,recon8Be.excitation);
-		FillHistogram2D({"sabrePhi_8Beex_degradedPunched","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon8BePunch.excitation);
-		FillHistogram2D({"sabreTheta_8Beex_degradedPunched","sabreTheta_8Beex;#theta (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},sabreCoords.Theta()*s_rad2deg,recon8BePunch.excitation);
-		FillHistogram2D({"sabrePhi_8Beex_degraded","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon8BeDegrade.excitation);
-		FillHistogram2D({"sabreTheta_8Beex_degraded","sabreTheta_8Beex;#theta (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},sabreCoords.Theta()*s_rad2deg,recon8BeDegrade.excitation);
-		FillHistogram2D({"relAngle_recovSabreKE_8bePunchRecon","relAngle_recovSabreKe;#theta_{rel}(deg);Recovered KE (MeV)",180,0.0,180.0,400,0.0,20.0},relAngle*s_rad2deg,recon8BePunch.sabreRxnKE);
+			FillHistogram1D(m_hEx8beDegradedPunched04, recon8BePunch.excitation);
+			FillHistogram1D(m_hEx8beDegraded04, recon8BeDegrade.excitation);
+		}
+		FillHistogram2D(m_hXavgEx8beDegradedPunched, m_eventPtr->xavg, recon8BePunch.excitation);
+		FillHistogram2D(m_hXavgEx8beDegraded, m_eventPtr->xavg, recon8BeDegrade.excitation);
+		FillHistogram2D(m_hSabrePhi5LiexDegDets,Phi360(sabreCoords.Phi())*s_rad2deg,recon5Li.excitation);
+		FillHistogram2D(m_hSabreTheta5LiexDegDets,sabreCoords.Theta()*s_rad2deg,recon5Li.excitation);
+		FillHistogram2D(m_hSabrePhi8BeexDegDets,Phi360(sabreCoords.Phi())*s_rad2deg,recon8Be.excitation);
+		FillHistogram2D(m_hSabreTheta8BeexDegDets,sabreCoords.Theta()*s_rad2deg,recon8Be.excitation);
+		FillHistogram2D(m_hSabrePhi8BeexDegradedPunched,Phi360(sabreCoords.Phi())*s_rad2deg,recon8BePunch.excitation);
+		FillHistogram2D(m_hSabreTheta8BeexDegradedPunched,sabreCoords.Theta()*s_rad2deg,recon8BePunch.excitation);
+		FillHistogram2D(m_hSabrePhi8BeexDegraded,Phi360(sabreCoords.Phi())*s_rad2deg,recon8BeDegrade.excitation);
+		FillHistogram2D(m_hSabreTheta8BeexDegraded,sabreCoords.Theta()*s_rad2deg,recon8BeDegrade.excitation);
+		FillHistogram2D(m_hRelAngleRecovSabreKE8bePunchRecon,relAngle*s_rad2deg,recon8BePunch.sabreRxnKE);
 		
 		//Some KE vs. rel angle plots.
-		FillHistogram2D({"relAngle_sabreKE_degDets","relAngle_sabreKE_degDets;#theta_{rel};SABRE E(Mev)",180,0.0,180.0,400,0.0,20.0},relAngle*s_rad2deg,pair.ringE);
-		FillHistogram2D({"relAngle_sabreKE_degraded","relAngle_sabreKE_degraded;#theta_{rel};SABRE E(Mev)",180,0.0,180.0,400,0.0,20.0},relAngle*s_rad2deg,recon8BeDegrade.sabreRxnKE);
-		FillHistogram2D({"relAngle_sabreKE_degradedPunched","relAngle_sabreKE_degradedPunched;#theta_{rel};SABRE E(Mev)",180,0.0,180.0,400,0.0,20.0},relAngle*s_rad2deg,recon8BePunch.sabreRxnKE);
+		FillHistogram2D(m_hRelAngleSabreKEDegDets,relAngle*s_rad2deg,pair.ringE);
+		FillHistogram2D(m_hRelAngleSabreKEDegraded,relAngle*s_rad2deg,recon8BeDegrade.sabreRxnKE);
+		FillHistogram2D(m_hRelAngleSabreKEDegradedPunched,relAngle*s_rad2deg,recon8BePunch.sabreRxnKE);
 
 		if(recon8Be.excitation > 2.2 && recon8Be.excitation < 3.8)
 		{
-			FillHistogram1D({"xavg_gated_8be1ex_degDets", "xavg_gated_8be1ex_degDets;xavg;counts",600,-300.0,300.0}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8be1exDegDets, m_eventPtr->xavg);
 		}
 		if(recon7Be.excitation > -0.1 && recon7Be.excitation < 0.15)
 		{
-			FillHistogram1D({"xavg_gated7Begs_degDets", "xavg_gated7Begs_degDets;xavg;counts",600,-300.0,300.0}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated7BegsDegDets, m_eventPtr->xavg);
 		}
 
 		//Need to switch between cases, reject looking at data that has already been reconstructed correctly
 		if(recon8BeDegrade.excitation > -0.5 && recon8BeDegrade.excitation < 0.5)
 		{
-			FillHistogram1D({"xavg_gated_8begs_degraded","xavg_gated_8begs_degraded;xavg;counts",600,-300,300}, m_eventPtr->xavg);
-			FillHistogram1D({"xavg_gated_8begs_recoveredSum","xavg_gated_8begs_recoveredSum;xavg;counts",600,-300,300}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8begsDegraded, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8begsRecoveredSum, m_eventPtr->xavg);
 		}
 		else if(recon8BeDegrade.excitation > 2.0 && recon8BeDegrade.excitation < 4.0)
 		{
-			FillHistogram1D({"xavg_gated_8be1ex_degraded","xavg_gated_8be1ex_degraded;xavg;counts",600,-300,300}, m_eventPtr->xavg);
-			FillHistogram1D({"xavg_gated_8be1ex_recoveredSum","xavg_gated_8be1ex_recoveredSum;xavg;counts",600,-300,300}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8be1exDegraded, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8be1exRecoveredSum, m_eventPtr->xavg);
 		}
 		else if(recon8BePunch.excitation > -1.0 && recon8BePunch.excitation < 1.0)
 		{
-			FillHistogram1D({"xavg_gated_8begs_degradedPunched","xavg_gated_8begs_degradedPunched;xavg;counts",600,-300,300}, m_eventPtr->xavg);
-			FillHistogram1D({"xavg_gated_8begs_recoveredSum","xavg_gated_8begs_recoveredSum;xavg;counts",600,-300,300}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8begsDegradedPunched, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8begsRecoveredSum, m_eventPtr->xavg);
 		}
 		else if(recon8BePunch.excitation > 1.0 && recon8BePunch.excitation < 5.0)
 		{
-			FillHistogram1D({"xavg_gated_8be1ex_degradedPunched","xavg_gated_8be1ex_degradedPunched;xavg;counts",600,-300,300}, m_eventPtr->xavg);
-			FillHistogram1D({"xavg_gated_8be1ex_recoveredSum","xavg_gated_8be1ex_recoveredSum;xavg;counts",600,-300,300}, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8be1exDegradedPunched, m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8be1exRecoveredSum, m_eventPtr->xavg);
 			if(pair.detID == 0 || pair.detID == 4)
 			{
-				FillHistogram1D({"xavg_gated_8be1ex_degradedPunched_04","xavg_gated_8be1ex_degradedPunched_04;xavg;counts",600,-300,300}, m_eventPtr->xavg);
+				FillHistogram1D(m_hXavgGated8be1exDegradedPunched04, m_eventPtr->xavg);
 			}
 			if(pair.local_wedge != 0 && pair.local_wedge != 7 && pair.local_ring != 15 && pair.local_ring != 0) //Edges might not be degraded right
 			{
-				FillHistogram1D({"xavg_gated_8be1ex_degradedPunched_rejectEdge","xavg_gated_8be1ex_degradedPunched_rejectEdge;xavg;counts",600,-300,300}, m_eventPtr->xavg);
-				FillHistogram1D({"xavg_gated_8be1ex_recoveredSum_rejectEdge","xavg_gated_8be1ex_recoveredSum_rejectEdge;xavg;counts",600,-300,300}, m_eventPtr->xavg);
+				FillHistogram1D(m_hXavgGated8be1exDegradedPunchedRejectEdge, m_eventPtr->xavg);
+				FillHistogram1D(m_hXavgGated8be1exRecoveredSumRejectEdge, m_eventPtr->xavg);
 				if(pair.detID == 0 || pair.detID == 4)
-					FillHistogram1D({"xavg_gated_8be1ex_degradedPunched_rejectEdge_04","xavg_gated_8be1ex_degradedPunched_rejectEdge_04;xavg;counts",600,-300,300}, m_eventPtr->xavg);
+					FillHistogram1D(m_hXavgGated8be1exDegradedPunchedRejectEdge04, m_eventPtr->xavg);
 			}
 		}
 		if(!(recon8BeDegrade.excitation > -1.0 && recon8BeDegrade.excitation < 4.0))
 		{
-			FillHistogram1D({"ex_8be_degradedPunched_rejectPrev","ex_8be_degradedPunched_rejectPrev;E_x(MeV);counts",300,-10.0,20.0}, recon8BePunch.excitation);
-			FillHistogram2D({"sabrePhi_8Beex_degradedPunched_rejectPrev","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon8BePunch.excitation);
-			FillHistogram2D({"xavg_ex8be_degradedPunched_rejectPrev","xavg_ex8be_degradedPunched;xavg;E_x(MeV)",600,-300.0,300.0,300,-10.0,20.0}, m_eventPtr->xavg, recon8BePunch.excitation);
+			FillHistogram1D(m_hEx8beDegradedPunchedRejectPrev, recon8BePunch.excitation);
+			FillHistogram2D(m_hSabrePhi8BeexDegradedPunchedRejectPrev,Phi360(sabreCoords.Phi())*s_rad2deg,recon8BePunch.excitation);
+			FillHistogram2D(m_hXavgEx8beDegradedPunchedRejectPrev, m_eventPtr->xavg, recon8BePunch.excitation);
 			if(recon8BePunch.excitation > -1.0 && recon8BePunch.excitation < 5.0)
-				FillHistogram1D({"xavg_gated_8beex_low_degradedPunched","xavg_gated_8beex_low_degradedPunched;xavg;counts",600,-300.0,300.0},m_eventPtr->xavg);
+				FillHistogram1D(m_hXavgGated8beexLowDegradedPunched,m_eventPtr->xavg);
 			if(pair.detID == 0 || pair.detID == 4)
 			{
-				FillHistogram1D({"ex_8be_degradedPunched04_rejectPrev","ex_8be_degradedPunched04_rejectPrev; E_x(MeV); counts",300,-10.0,20.0}, recon8BePunch.excitation);
-				FillHistogram1D({"ex_8be_degraded04_rejectPrev","ex_8be_degraded04_rejectPrev; E_x(MeV); counts",300,-10.0,20.0}, recon8BeDegrade.excitation);
+				FillHistogram1D(m_hEx8beDegradedPunched04RejectPrev, recon8BePunch.excitation);
+				FillHistogram1D(m_hEx8beDegraded04RejectPrev, recon8BeDegrade.excitation);
 			}
 		}
 		else
 		{
-			FillHistogram1D({"xavg_gated_8beex_low_degraded","xavg_gated_8beex_low_degraded;xavg;counts",600,-300.0,300.0},m_eventPtr->xavg);
+			FillHistogram1D(m_hXavgGated8beexLowDegraded,m_eventPtr->xavg);
 		}
 
-		FillHistogram2D({"sabreE_sabreTheta_degDets", "sabreE_sabreTheta_degDets;#theta (deg);E(MeV)",180,0.0,180.0,400,0.0,20.0}, sabreCoords.Theta()*s_rad2deg, pair.ringE);
-		FillHistogram2D({"xavg_sabreE_degDets", "xavg_sabreE_degDets;xavg;E(MeV)", 600,0.-300.0,300.0,400,0.0,20.0}, m_eventPtr->xavg, pair.ringE);
-		FillHistogram2D({"9Btheta_sabreTheta_degDets","9Btheta_sabreTheta_degDets;#theta_{9B};#theta_{SABRE}",180,0.0,180.0,180,0.0,180.0}, recon9B.residThetaLab*s_rad2deg, sabreCoords.Theta()*s_rad2deg);
-		FillHistogram2D({"sabreE_relAngle_degDets","sabreE_relAngle_degDets;#theta_{rel};E(MeV)",180,0.0,180.0,400,0.0,20.0},relAngle*s_rad2deg, pair.ringE);
+		FillHistogram2D(m_hSabreESabreThetaDegDets, sabreCoords.Theta()*s_rad2deg, pair.ringE);
+		FillHistogram2D(m_hXavgSabreEDegDets, m_eventPtr->xavg, pair.ringE);
+		FillHistogram2D(m_h9BthetaSabreThetaDegDets, recon9B.residThetaLab*s_rad2deg, sabreCoords.Theta()*s_rad2deg);
+		FillHistogram2D(m_hSabreERelAngleDegDets,relAngle*s_rad2deg, pair.ringE);
 		if(pair.local_wedge != 0 && pair.local_wedge != 7 && pair.local_ring != 15 && pair.local_ring != 0) //Edges might not be degraded right
 		{
-			FillHistogram2D({"sabreE_sabreTheta_degDets_rejectEdge", "sabreE_sabreTheta_degDets;#theta (deg);E(MeV)",180,0.0,180.0,400,0.0,20.0}, sabreCoords.Theta()*s_rad2deg, pair.ringE);
-			FillHistogram2D({"xavg_sabreE_degDets_rejectEdge", "xavg_sabreE_degDets;xavg;E(MeV)",600,0.-300.0,300.0,400,0.0,20.0}, m_eventPtr->xavg, pair.ringE);
-			FillHistogram1D({"xavg_degDets_rejectEdge","xavg_degDets_rejectEdge;xavg",600,-300.0,300.0}, m_eventPtr->xavg);
-			FillHistogram2D({"9Btheta_sabreTheta_degDets_rejectEdge","9Btheta_sabreTheta_degDets_rejectEdge;#theta_{9B};#theta_{SABRE}",180,0.0,180.0,180,0.0,180.0}, recon9B.residThetaLab*s_rad2deg,
+			FillHistogram2D(m_hSabreESabreThetaDegDetsRejectEdge, sabreCoords.Theta()*s_rad2deg, pair.ringE);
+			FillHistogram2D(m_hXavgSabreEDegDetsRejectEdge, m_eventPtr->xavg, pair.ringE);
+			FillHistogram1D(m_hXavgDegDetsRejectEdge, m_eventPtr->xavg);
+			FillHistogram2D(m_h9BthetaSabreThetaDegDetsRejectEdge, recon9B.residThetaLab*s_rad2deg,
 							  sabreCoords.Theta()*s_rad2deg);
-			FillHistogram2D({"sabreE_relAngle_degDets_rejectEdge","sabreE_relAngle_degDets_rejectEdge;#theta_{rel};E(MeV)",180,0.0,180.0,400,0.0,20.0},relAngle*s_rad2deg, pair.ringE);
+			FillHistogram2D(m_hSabreERelAngleDegDetsRejectEdge,relAngle*s_rad2deg, pair.ringE);
 			if(!(recon8BeDegrade.excitation > -1.0 && recon8BeDegrade.excitation < 5.0))
 			{
-				FillHistogram1D({"ex_8be_degradedPunched_rejectPrev_rejectEdge","ex_8be_degradedPunched_rejectPrev;E_x(MeV);counts",300,-10.0,20.0}, recon8BePunch.excitation);
-				FillHistogram2D({"sabrePhi_8Beex_degradedPunched_rejectPrev_rejectEdge","sabrePhi_8Beex;#phi (deg);E_x (MeV)",360,0.0,360.0,1000,-20.0,10.0},Phi360(sabreCoords.Phi())*s_rad2deg,recon8BePunch.excitation);
-				FillHistogram2D({"xavg_ex8be_degradedPunched_rejectPrev_rejectEdge","xavg_ex8be_degradedPunched;xavg;E_x(MeV)",600,-300.0,300.0,300,-10.0,20.0}, m_eventPtr->xavg, recon8BePunch.excitation);
+				FillHistogram1D(m_hEx8beDegradedPunchedRejectPrevRejectEdge, recon8BePunch.excitation);
+				FillHistogram2D(m_hSabrePhi8BeexDegradedPunchedRejectPrevRejectEdge,Phi360(sabreCoords.Phi())*s_rad2deg,recon8BePunch.excitation);
+				FillHistogram2D(m_hXavgEx8beDegradedPunchedRejectPrevRejectEdge, m_eventPtr->xavg, recon8BePunch.excitation);
 				if(recon8BePunch.excitation > -1.0 && recon8BePunch.excitation < 5.0)
-					FillHistogram1D({"xavg_gated_8beex_low_degradedPunched_rejectEdge","xavg_gated_8beex_low_degradedPunched;xavg;counts",600,-300.0,300.0},m_eventPtr->xavg);
+					FillHistogram1D(m_hXavgGated8beexLowDegradedPunchedRejectEdge,m_eventPtr->xavg);
 			}
 			else
 			{
-				FillHistogram1D({"xavg_gated_8beex_low_degraded_rejectEdge","xavg_gated_8beex_low_degraded;xavg;counts",600,-300.0,300.0},m_eventPtr->xavg);
+				FillHistogram1D(m_hXavgGated8beexLowDegradedRejectEdge,m_eventPtr->xavg);
 			}
 		}
 	}
@@ -3,8 +3,12 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 #include <unordered_map>
+#include <istream>
 #include <TROOT.h>
+#include <TH1.h>
+#include <TH2.h>
 #include "CutHandler.h"
 #include "Reconstructor.h"
 
@@ -31,6 +35,17 @@ namespace SabreRecon {
 		double maxY;
 	};
 
+	//Index of a booked histogram in the Histogrammer registry; typed so 1D and 2D fills cannot be mixed up
+	struct Histogram1DHandle
+	{
+		std::size_t index = 0;
+	};
+
+	struct Histogram2DHandle
+	{
+		std::size_t index = 0;
+	};
+
 	class Histogrammer
 	{
 	public:
@@ -43,23 +58,123 @@ namespace SabreRecon {
 	private:
 		void RunSabre(const SabrePair& pair);
 		void RunDegradedSabre(const SabrePair& pair);
+		void RunBreakups();
+		void PrintBreakupStatistics(const std::string& name, const BreakupStatistics& stats) const;
+		void PrintTableAccuracy() const;
+		void ValidatePrecision(const SabrePair& pair, const ReconHypothesis* hypotheses, const ReconResult* results, std::size_t n);
 
 		void ParseConfig(const std::string& name);
-		void FillHistogram1D(const Histogram1DParams& params, double value);
-		void FillHistogram2D(const Histogram2DParams& params, double valueX, double valueY);
+		void ReadBreakupCuts(std::istream& input, const std::string& endToken, BreakupCuts& cuts, std::string& detectors);
+		//BreakupCuts::detectorPairs for the detectors setting of a breakup cuts block
+		uint32_t GetBreakupDetectorPairs(const std::string& detectors) const;
+
+		/*
+			Every histogram is booked once at startup and filled through its handle, an index into the registry, so the event
+			loop does no string work or map lookups. The ROOT object is created on the first fill, so (as before booking)
+			only histograms that were filled are allocated and written.
+		*/
+		void BookHistograms();
+		Histogram1DHandle BookHistogram1D(const Histogram1DParams& params);
+		Histogram2DHandle BookHistogram2D(const Histogram2DParams& params);
+
+		inline void FillHistogram1D(Histogram1DHandle handle, double value)
+		{
+			Booked1D& booked = m_histograms1D[handle.index];
+			if(!booked.histogram)
+				booked.histogram = std::make_unique<TH1F>(booked.params.name.c_str(), booked.params.title.c_str(), booked.params.bins, booked.params.min,
+														  booked.params.max);
+			booked.histogram->Fill(value);
+		}
+
+		inline void FillHistogram2D(Histogram2DHandle handle, double valueX, double valueY)
+		{
+			Booked2D& booked = m_histograms2D[handle.index];
+			if(!booked.histogram)
+				booked.histogram = std::make_unique<TH2F>(booked.params.name.c_str(), booked.params.title.c_str(), booked.params.binsX, booked.params.minX,
+														  booked.params.maxX, booked.params.binsY, booked.params.minY, booked.params.maxY);
+			booked.histogram->Fill(valueX, valueY);
+		}
 
 		std::string m_inputData;
 		std::string m_outputData;
 
 		CalEvent* m_eventPtr;
 		double m_beamKE;
+		uint64_t m_seed; //smearing seed; optional in the config, 0 by default
+		ReconPrecision m_precision; //optional in the config, exact by default
+		bool m_interpolateTableTheta; //optional in the config, off by default
+		uint64_t m_nValidationEvents; //SABRE events also run with the exact tier to validate the fast tier; optional in the config
+		uint64_t m_nValidatedEvents;
+		PrecisionDeviation m_precisionDeviation;
 
 		Reconstructor m_recon;
+		ReconWorkspace m_workspace;
 		CutHandler m_cuts;
 
+		//Reactions of interest, resolved once after the reconstructor is initialized
+		ReactionContext m_rxn9B, m_rxn5Li, m_rxn8Be, m_rxn7Be, m_rxn14N;
+		//Hypotheses reconstructed together for a SABRE hit, sharing its smeared position; order is fixed by RunSabre/RunDegradedSabre
+		static constexpr std::size_t s_nSabreHypotheses = 5;
+		static constexpr std::size_t s_nDegradedHypotheses = 6;
+		ReconHypothesis m_sabreHypotheses[s_nSabreHypotheses];
+		ReconHypothesis m_degradedHypotheses[s_nDegradedHypotheses];
+
+		//Multi-hit breakups searched for in SABRE alone, with their prefilters and running cost
+		BreakupContext m_breakup8Be, m_breakup12C;
+		BreakupCuts m_breakupCuts8Be, m_breakupCuts12C;
+		BreakupStatistics m_breakupStats8Be, m_breakupStats12C;
+		static constexpr std::size_t s_maxBreakupCandidates = 256;
+		BreakupCandidate m_breakupCandidates[s_maxBreakupCandidates];
+
 		bool m_isValid;
 
-		std::unordered_map<std::string, std::shared_ptr<TObject> > m_histoMap;
+		struct Booked1D
+		{
+			Histogram1DParams params;
+			std::unique_ptr<TH1F> histogram;
+		};
+
+		struct Booked2D
+		{
+			Histogram2DParams params;
+			std::unique_ptr<TH2F> histogram;
+		};
+
+		std::vector<Booked1D> m_histograms1D;
+		std::vector<Booked2D> m_histograms2D;
+		std::unordered_map<std::string, std::size_t> m_bookedNames1D, m_bookedNames2D; //booking only, so names filled from several places share a histogram
+
+		//Histogram handles, by the function filling them
+		static constexpr int s_nSabreDetectors = 5; //for the per detector histograms
+		//Run
+		Histogram1DHandle m_hXavgGated, m_hSabreCountsGated;
+		//RunBreakups
+		Histogram1DHandle m_hBreakup8BeCandidates, m_hEx8Be2a, m_hBreakup12CCandidates, m_hEx12C3a;
+		Histogram2DHandle m_hSumKEEx8Be2a, m_hSumKEEx12C3a;
+		//RunSabre
+		Histogram1DHandle m_hXavgGatedSabre, m_hEx5Li, m_hEx7Be, m_hEx8Be, m_hEx14N, m_hXavgGated5Ligs, m_hXavgGated8Begs, m_hXavgGated7Begs,
+			m_hXavgGated7BegsReject14Ngs, m_hXavgGated14Ngs, m_hXavgNotGatedAllChannels;
+		Histogram2DHandle m_hScintECathodeE, m_hXavgTheta, m_hEx14N7Be, m_hSabreThetaSabreE, m_hXavgSabreE, m_h9BthetaSabreTheta, m_hSabreERelAngle,
+			m_hSabreTheta5Liex, m_hSabreTheta7Beex, m_hSabreTheta14Nex, m_hSabrePhi5Liex, m_hSabrePhi7Beex, m_hSabrePhi14Nex, m_hSabreESabreThetaNub,
+			m_hSabreESabrePhiNub, m_hSabreTheta5LiexNabinPeak, m_hSabreTheta7BeexNabinPeak, m_hSabrePhi5LiexNabinPeak, m_hSabrePhi7BeexNabinPeak,
+			m_hXavgSabreE7Begs, m_hSabreESabreTheta7begsNub, m_hSabreESabrePhi7begsNub;
+		//RunDegradedSabre
+		Histogram1DHandle m_hSabreCountsGatedDegraderDets, m_hIncidentAngle, m_hEx5LiDegDets, m_hEx7BeDegDets, m_hEx8beDegdDets,
+			m_hEx8beDegradedPunched, m_hEx8beDegradedPunchedDet[s_nSabreDetectors], m_hEx8beDegraded, m_hEx8beDegradedDet[s_nSabreDetectors],
+			m_hEx8beDegradedPunched04, m_hEx8beDegraded04, m_hXavgGated8be1exDegDets, m_hXavgGated7BegsDegDets, m_hXavgGated8begsDegraded,
+			m_hXavgGated8begsRecoveredSum, m_hXavgGated8be1exDegraded, m_hXavgGated8be1exRecoveredSum, m_hXavgGated8begsDegradedPunched,
+			m_hXavgGated8be1exDegradedPunched, m_hXavgGated8be1exDegradedPunched04, m_hXavgGated8be1exDegradedPunchedRejectEdge,
+			m_hXavgGated8be1exRecoveredSumRejectEdge, m_hXavgGated8be1exDegradedPunchedRejectEdge04, m_hEx8beDegradedPunchedRejectPrev,
+			m_hXavgGated8beexLowDegradedPunched, m_hEx8beDegradedPunched04RejectPrev, m_hEx8beDegraded04RejectPrev, m_hXavgGated8beexLowDegraded,
+			m_hXavgDegDetsRejectEdge, m_hEx8beDegradedPunchedRejectPrevRejectEdge, m_hXavgGated8beexLowDegradedPunchedRejectEdge,
+			m_hXavgGated8beexLowDegradedRejectEdge;
+		Histogram2DHandle m_hXavgEx8beDegDets, m_hXavgEx8beDegradedPunched, m_hXavgEx8beDegraded, m_hSabrePhi5LiexDegDets, m_hSabreTheta5LiexDegDets,
+			m_hSabrePhi8BeexDegDets, m_hSabreTheta8BeexDegDets, m_hSabrePhi8BeexDegradedPunched, m_hSabreTheta8BeexDegradedPunched,
+			m_hSabrePhi8BeexDegraded, m_hSabreTheta8BeexDegraded, m_hRelAngleRecovSabreKE8bePunchRecon, m_hRelAngleSabreKEDegDets,
+			m_hRelAngleSabreKEDegraded, m_hRelAngleSabreKEDegradedPunched, m_hSabrePhi8BeexDegradedPunchedRejectPrev,
+			m_hXavgEx8beDegradedPunchedRejectPrev, m_hSabreESabreThetaDegDets, m_hXavgSabreEDegDets, m_h9BthetaSabreThetaDegDets,
+			m_hSabreERelAngleDegDets, m_hSabreESabreThetaDegDetsRejectEdge, m_hXavgSabreEDegDetsRejectEdge, m_h9BthetaSabreThetaDegDetsRejectEdge,
+			m_hSabreERelAngleDegDetsRejectEdge, m_hSabrePhi8BeexDegradedPunchedRejectPrevRejectEdge, m_hXavgEx8beDegradedPunchedRejectPrevRejectEdge;
 
 		static constexpr double s_weakSabreThreshold = 0.2; //MeV
 		static constexpr double s_rad2deg = 180.0/M_PI;
@@ -0,0 +1,37 @@
+/*
+FastMath.h
+Approximate angle functions for the fast precision tier of the reconstruction. FastAtan2 uses the degree 9 odd polynomial
+of Abramowitz & Stegun 4.4.49 on [0, 1] and folds the other octants onto it; its absolute error is below 1.2e-5 rad
+everywhere. FastTheta/FastPhi follow the conventions of Vec3::Theta/Phi (0 for a null vector).
+*/
+#ifndef FAST_MATH_H
+#define FAST_MATH_H
+
+#include "Vec3.h"
+#include <cmath>
+
+namespace SabreRecon {
+
+	inline double FastAtan2(double y, double x)
+	{
+		double ax = std::fabs(x), ay = std::fabs(y);
+		if(ax == 0.0 && ay == 0.0)
+			return 0.0;
+
+		bool swapped = ay > ax;
+		double t = swapped ? ax/ay : ay/ax;
+		double t2 = t*t;
+		double angle = t*(0.9998660 + t2*(-0.3302995 + t2*(0.1801410 + t2*(-0.0851330 + t2*0.0208351))));
+		if(swapped)
+			angle = M_PI/2.0 - angle;
+		if(x < 0.0)
+			angle = M_PI - angle;
+		return y < 0.0 ? -angle : angle;
+	}
+
+	inline double FastTheta(const Vec3& v) { return FastAtan2(v.Perp(), v.Z()); }
+	inline double FastPhi(const Vec3& v) { return FastAtan2(v.Y(), v.X()); }
+
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+FourVec.h
+Energy-momentum 4-vector and Lorentz boost replacing TLorentzVector in the reconstruction core. Mass, angles and the
+boost use the same expressions as TLorentzVector, so results match the ROOT classes exactly.
+
+Boost holds gamma and the derived factor for a boost vector, so boosting several 4-vectors into the same frame only
+calculates them once.
+*/
+#ifndef FOUR_VEC_H
+#define FOUR_VEC_H
+
+#include "Vec3.h"
+
+namespace SabreRecon {
+
+	class FourVec
+	{
+	public:
+		constexpr FourVec() :
+			m_p(), m_e(0.0)
+		{
+		}
+
+		constexpr FourVec(double px, double py, double pz, double E) :
+			m_p(px, py, pz), m_e(E)
+		{
+		}
+
+		constexpr FourVec(const Vec3& p, double E) :
+			m_p(p), m_e(E)
+		{
+		}
+
+		constexpr double Px() const { return m_p.X(); }
+		constexpr double Py() const { return m_p.Y(); }
+		constexpr double Pz() const { return m_p.Z(); }
+		constexpr double E() const { return m_e; }
+		constexpr const Vec3& Vect() const { return m_p; }
+		constexpr void SetPxPyPzE(double px, double py, double pz, double E) { m_p.SetXYZ(px, py, pz); m_e = E; }
+
+		constexpr double M2() const { return m_e*m_e - m_p.Mag2(); }
+		inline double M() const
+		{
+			double mm = M2();
+			return mm < 0.0 ? -std::sqrt(-mm) : std::sqrt(mm);
+		}
+		inline double Theta() const { return m_p.Theta(); }
+		inline double Phi() const { return m_p.Phi(); }
+		//Velocity of the frame in which this 4-vector is at rest
+		constexpr Vec3 BoostVector() const { return Vec3(m_p.X()/m_e, m_p.Y()/m_e, m_p.Z()/m_e); }
+
+		constexpr FourVec& operator+=(const FourVec& v) { m_p += v.m_p; m_e += v.m_e; return *this; }
+		constexpr FourVec& operator-=(const FourVec& v) { m_p -= v.m_p; m_e -= v.m_e; return *this; }
+
+	private:
+		Vec3 m_p;
+		double m_e;
+	};
+
+	constexpr FourVec operator+(const FourVec& a, const FourVec& b) { return FourVec(a.Vect() + b.Vect(), a.E() + b.E()); }
+	constexpr FourVec operator-(const FourVec& a, const FourVec& b) { return FourVec(a.Vect() - b.Vect(), a.E() - b.E()); }
+
+	class Boost
+	{
+	public:
+		inline Boost(const Vec3& beta) :
+			m_beta(beta)
+		{
+			double b2 = beta.Mag2();
+			m_gamma = 1.0/std::sqrt(1.0 - b2);
+			m_gamma2 = b2 > 0.0 ? (m_gamma - 1.0)/b2 : 0.0;
+		}
+
+		inline FourVec operator()(const FourVec& v) const
+		{
+			double bp = m_beta.Dot(v.Vect());
+			return FourVec(v.Px() + m_gamma2*bp*m_beta.X() + m_gamma*m_beta.X()*v.E(),
+						   v.Py() + m_gamma2*bp*m_beta.Y() + m_gamma*m_beta.Y()*v.E(),
+						   v.Pz() + m_gamma2*bp*m_beta.Z() + m_gamma*m_beta.Z()*v.E(),
+						   m_gamma*(v.E() + bp));
+		}
+
+		inline const Vec3& GetBeta() const { return m_beta; }
+		inline double GetGamma() const { return m_gamma; }
+
+	private:
+		Vec3 m_beta;
+		double m_gamma;
+		double m_gamma2; //(gamma - 1)/beta^2
+	};
+
+}
+
+#endif
@@ -0,0 +1,23 @@
+/*
+RootConversion.h
+Conversions between the reconstruction core's vectors and the ROOT classes, for use where results are handed to ROOT
+(histogramming, trees, drawing). The core itself does not include any ROOT headers.
+*/
+#ifndef ROOT_CONVERSION_H
+#define ROOT_CONVERSION_H
+
+#include "Vec3.h"
+#include "FourVec.h"
+#include "TVector3.h"
+#include "TLorentzVector.h"
+
+namespace SabreRecon {
+
+	inline TVector3 ToTVector3(const Vec3& v) { return TVector3(v.X(), v.Y(), v.Z()); }
+	inline Vec3 ToVec3(const TVector3& v) { return Vec3(v.X(), v.Y(), v.Z()); }
+	inline TLorentzVector ToTLorentzVector(const FourVec& v) { return TLorentzVector(v.Px(), v.Py(), v.Pz(), v.E()); }
+	inline FourVec ToFourVec(const TLorentzVector& v) { return FourVec(v.Px(), v.Py(), v.Pz(), v.E()); }
+
+}
+
+#endif
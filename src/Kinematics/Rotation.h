@@ -0,0 +1,72 @@
+/*
+Rotation.h
+3x3 rotation matrix replacing TRotation for the SABRE detector geometry. RotateY/RotateZ compose a rotation about the
+fixed axis onto the current one, with the same element updates as TRotation.
+*/
+#ifndef ROTATION_H
+#define ROTATION_H
+
+#include "Vec3.h"
+
+namespace SabreRecon {
+
+	class Rotation
+	{
+	public:
+		constexpr Rotation() :
+			m_xx(1.0), m_xy(0.0), m_xz(0.0), m_yx(0.0), m_yy(1.0), m_yz(0.0), m_zx(0.0), m_zy(0.0), m_zz(1.0)
+		{
+		}
+
+		constexpr double XX() const { return m_xx; }
+		constexpr double XY() const { return m_xy; }
+		constexpr double XZ() const { return m_xz; }
+		constexpr double YX() const { return m_yx; }
+		constexpr double YY() const { return m_yy; }
+		constexpr double YZ() const { return m_yz; }
+		constexpr double ZX() const { return m_zx; }
+		constexpr double ZY() const { return m_zy; }
+		constexpr double ZZ() const { return m_zz; }
+
+		inline Rotation& RotateY(double angle)
+		{
+			double c = std::cos(angle), s = std::sin(angle);
+			double x = m_zx, y = m_zy, z = m_zz;
+			m_zx = c*x - s*m_xx;
+			m_zy = c*y - s*m_xy;
+			m_zz = c*z - s*m_xz;
+			m_xx = s*x + c*m_xx;
+			m_xy = s*y + c*m_xy;
+			m_xz = s*z + c*m_xz;
+			return *this;
+		}
+
+		inline Rotation& RotateZ(double angle)
+		{
+			double c = std::cos(angle), s = std::sin(angle);
+			double x = m_xx, y = m_xy, z = m_xz;
+			m_xx = c*x - s*m_yx;
+			m_xy = c*y - s*m_yy;
+			m_xz = c*z - s*m_yz;
+			m_yx = s*x + c*m_yx;
+			m_yy = s*y + c*m_yy;
+			m_yz = s*z + c*m_yz;
+			return *this;
+		}
+
+		constexpr Vec3 operator*(const Vec3& v) const
+		{
+			return Vec3(m_xx*v.X() + m_xy*v.Y() + m_xz*v.Z(),
+						m_yx*v.X() + m_yy*v.Y() + m_yz*v.Z(),
+						m_zx*v.X() + m_zy*v.Y() + m_zz*v.Z());
+		}
+
+	private:
+		double m_xx, m_xy, m_xz;
+		double m_yx, m_yy, m_yz;
+		double m_zx, m_zy, m_zz;
+	};
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+/*
+Vec3.h
+Plain 3-vector used by the reconstruction core in place of TVector3: no TObject base or virtual destructor, so it is
+trivially copyable and can live in arrays. Angle and magnitude calculations use the same expressions as TVector3, so
+results match the ROOT classes exactly.
+*/
+#ifndef VEC3_H
+#define VEC3_H
+
+#include <cmath>
+
+namespace SabreRecon {
+
+	class Vec3
+	{
+	public:
+		constexpr Vec3() :
+			m_x(0.0), m_y(0.0), m_z(0.0)
+		{
+		}
+
+		constexpr Vec3(double x, double y, double z) :
+			m_x(x), m_y(y), m_z(z)
+		{
+		}
+
+		constexpr double X() const { return m_x; }
+		constexpr double Y() const { return m_y; }
+		constexpr double Z() const { return m_z; }
+		constexpr void SetXYZ(double x, double y, double z) { m_x = x; m_y = y; m_z = z; }
+
+		constexpr double Dot(const Vec3& v) const { return m_x*v.m_x + m_y*v.m_y + m_z*v.m_z; }
+		constexpr double Mag2() const { return m_x*m_x + m_y*m_y + m_z*m_z; }
+		constexpr double Perp2() const { return m_x*m_x + m_y*m_y; }
+		inline double Mag() const { return std::sqrt(Mag2()); }
+		inline double Perp() const { return std::sqrt(Perp2()); }
+		inline double Theta() const { return m_x == 0.0 && m_y == 0.0 && m_z == 0.0 ? 0.0 : std::atan2(Perp(), m_z); }
+		inline double Phi() const { return m_x == 0.0 && m_y == 0.0 ? 0.0 : std::atan2(m_y, m_x); }
+
+		inline Vec3 Unit() const
+		{
+			double mag2 = Mag2();
+			double invMag = mag2 > 0.0 ? 1.0/std::sqrt(mag2) : 1.0;
+			return Vec3(m_x*invMag, m_y*invMag, m_z*invMag);
+		}
+
+		inline void SetMagThetaPhi(double mag, double theta, double phi)
+		{
+			double amag = std::fabs(mag);
+			double perp = amag*std::sin(theta);
+			m_x = perp*std::cos(phi);
+			m_y = perp*std::sin(phi);
+			m_z = amag*std::cos(theta);
+		}
+
+		constexpr Vec3 operator-() const { return Vec3(-m_x, -m_y, -m_z); }
+		constexpr Vec3& operator+=(const Vec3& v) { m_x += v.m_x; m_y += v.m_y; m_z += v.m_z; return *this; }
+		constexpr Vec3& operator-=(const Vec3& v) { m_x -= v.m_x; m_y -= v.m_y; m_z -= v.m_z; return *this; }
+		constexpr Vec3& operator*=(double s) { m_x *= s; m_y *= s; m_z *= s; return *this; }
+
+	private:
+		double m_x, m_y, m_z;
+	};
+
+	constexpr Vec3 operator+(const Vec3& a, const Vec3& b) { return Vec3(a.X() + b.X(), a.Y() + b.Y(), a.Z() + b.Z()); }
+	constexpr Vec3 operator-(const Vec3& a, const Vec3& b) { return Vec3(a.X() - b.X(), a.Y() - b.Y(), a.Z() - b.Z()); }
+	constexpr Vec3 operator*(double s, const Vec3& v) { return Vec3(s*v.X(), s*v.Y(), s*v.Z()); }
+	constexpr Vec3 operator*(const Vec3& v, double s) { return Vec3(s*v.X(), s*v.Y(), s*v.Z()); }
+	constexpr bool operator==(const Vec3& a, const Vec3& b) { return a.X() == b.X() && a.Y() == b.Y() && a.Z() == b.Z(); }
+	constexpr bool operator!=(const Vec3& a, const Vec3& b) { return !(a == b); }
+
+}
+
+#endif
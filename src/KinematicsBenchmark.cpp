@@ -0,0 +1,174 @@
+#include "Kinematics/FourVec.h"
+#include "TLorentzVector.h"
+#include "TVector3.h"
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <exception>
+
+/*
+	Times the reconstruction core's 4-vector path (FourVec/Vec3/Boost) against the TLorentzVector/TVector3 path it
+	replaced. Both run the SABRE decay reconstruction (residual and fragment 4-vectors, invariant mass, boost of the
+	breakup particle into the residual's rest frame, CM angles) on the same randomly generated inputs, and the results
+	are compared, as the core is expected to reproduce the ROOT classes exactly.
+	Usage: KinematicsBenchmark [number of events]
+*/
+
+struct BenchmarkInput
+{
+	double parent[4];
+	double eject[4];
+	double decayBreak[4];
+};
+
+struct BenchmarkResult
+{
+	double excitation;
+	double thetaCM;
+	double phiCM;
+};
+
+static void MakeVector(std::mt19937_64& gen, double mass, double keMin, double keMax, double thetaMax, double vec[4])
+{
+	std::uniform_real_distribution<double> keDist(keMin, keMax);
+	std::uniform_real_distribution<double> cosDist(std::cos(thetaMax), 1.0);
+	std::uniform_real_distribution<double> phiDist(-M_PI, M_PI);
+
+	double ke = keDist(gen);
+	double p = std::sqrt(ke*(ke + 2.0*mass));
+	double theta = std::acos(cosDist(gen));
+	double phi = phiDist(gen);
+	vec[0] = p*std::sin(theta)*std::cos(phi);
+	vec[1] = p*std::sin(theta)*std::sin(phi);
+	vec[2] = p*std::cos(theta);
+	vec[3] = ke + mass;
+}
+
+static void RunCore(const std::vector<BenchmarkInput>& inputs, std::vector<BenchmarkResult>& results, double massFrag)
+{
+	using namespace SabreRecon;
+	for(std::size_t i=0; i<inputs.size(); i++)
+	{
+		const BenchmarkInput& in = inputs[i];
+		FourVec parent_vec(in.parent[0], in.parent[1], in.parent[2], in.parent[3]);
+		FourVec eject_vec(in.eject[0], in.eject[1], in.eject[2], in.eject[3]);
+		FourVec decayBreak_vec(in.decayBreak[0], in.decayBreak[1], in.decayBreak[2], in.decayBreak[3]);
+
+		FourVec resid_vec = parent_vec - eject_vec;
+		FourVec decayFrag_vec = resid_vec - decayBreak_vec;
+		results[i].excitation = decayFrag_vec.M() - massFrag;
+		decayBreak_vec = Boost(-1.0*resid_vec.BoostVector())(decayBreak_vec);
+		results[i].thetaCM = decayBreak_vec.Theta();
+		results[i].phiCM = decayBreak_vec.Phi();
+	}
+}
+
+static void RunRoot(const std::vector<BenchmarkInput>& inputs, std::vector<BenchmarkResult>& results, double massFrag)
+{
+	for(std::size_t i=0; i<inputs.size(); i++)
+	{
+		const BenchmarkInput& in = inputs[i];
+		TLorentzVector parent_vec(in.parent[0], in.parent[1], in.parent[2], in.parent[3]);
+		TLorentzVector eject_vec(in.eject[0], in.eject[1], in.eject[2], in.eject[3]);
+		TLorentzVector decayBreak_vec(in.decayBreak[0], in.decayBreak[1], in.decayBreak[2], in.decayBreak[3]);
+
+		TLorentzVector resid_vec = parent_vec - eject_vec;
+		TLorentzVector decayFrag_vec = resid_vec - decayBreak_vec;
+		results[i].excitation = decayFrag_vec.M() - massFrag;
+		TVector3 boost = resid_vec.BoostVector();
+		decayBreak_vec.Boost(-1.0*boost);
+		results[i].thetaCM = decayBreak_vec.Theta();
+		results[i].phiCM = decayBreak_vec.Phi();
+	}
+}
+
+//Best of several repetitions, in ns per event
+template<typename Func>
+static double TimePath(Func&& func, const std::vector<BenchmarkInput>& inputs, std::vector<BenchmarkResult>& results, double massFrag)
+{
+	static constexpr int s_nRepetitions = 5;
+	double best = 0.0;
+	for(int rep=0; rep<s_nRepetitions; rep++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		func(inputs, results, massFrag);
+		auto stop = std::chrono::steady_clock::now();
+		double time = std::chrono::duration<double, std::nano>(stop - start).count()/inputs.size();
+		if(rep == 0 || time < best)
+			best = time;
+	}
+	return best;
+}
+
+int main(int argc, const char** argv)
+{
+	if(argc > 2)
+	{
+		std::cerr<<"Usage: KinematicsBenchmark [number of events]"<<std::endl;
+		return 1;
+	}
+
+	std::size_t nEvents = 1000000;
+	if(argc == 2)
+	{
+		try
+		{
+			nEvents = std::stoul(argv[1]);
+		}
+		catch(const std::exception&)
+		{
+			nEvents = 0;
+		}
+		if(nEvents == 0)
+		{
+			std::cerr<<"ERR -- Invalid number of events "<<argv[1]<<std::endl;
+			return 1;
+		}
+	}
+
+	//10B(3He,a)9B -> p + 8Be at 24 MeV, masses in MeV
+	static constexpr double s_massTarget = 9324.436;
+	static constexpr double s_massProjectile = 2808.391;
+	static constexpr double s_massEject = 3727.379;
+	static constexpr double s_massDecay = 938.272;
+	static constexpr double s_massFrag = 7454.850;
+
+	std::mt19937_64 gen(1234);
+	std::vector<BenchmarkInput> inputs(nEvents);
+	for(auto& in : inputs)
+	{
+		double projectile[4];
+		MakeVector(gen, s_massProjectile, 24.0, 24.0, 0.0, projectile);
+		in.parent[0] = projectile[0];
+		in.parent[1] = projectile[1];
+		in.parent[2] = projectile[2];
+		in.parent[3] = projectile[3] + s_massTarget;
+		MakeVector(gen, s_massEject, 10.0, 30.0, 30.0*M_PI/180.0, in.eject);
+		MakeVector(gen, s_massDecay, 0.2, 15.0, M_PI, in.decayBreak);
+	}
+
+	std::vector<BenchmarkResult> coreResults(nEvents), rootResults(nEvents);
+	double coreTime = TimePath(RunCore, inputs, coreResults, s_massFrag);
+	double rootTime = TimePath(RunRoot, inputs, rootResults, s_massFrag);
+
+	double maxExDiff = 0.0, maxAngleDiff = 0.0;
+	for(std::size_t i=0; i<nEvents; i++)
+	{
+		maxExDiff = std::max(maxExDiff, std::fabs(coreResults[i].excitation - rootResults[i].excitation));
+		maxAngleDiff = std::max({maxAngleDiff, std::fabs(coreResults[i].thetaCM - rootResults[i].thetaCM),
+								 std::fabs(coreResults[i].phiCM - rootResults[i].phiCM)});
+	}
+
+	std::cout<<"Events: "<<nEvents<<std::endl;
+	std::cout<<"FourVec/Boost: "<<coreTime<<" ns/event"<<std::endl;
+	std::cout<<"TLorentzVector: "<<rootTime<<" ns/event"<<std::endl;
+	std::cout<<"Speedup: "<<rootTime/coreTime<<std::endl;
+	std::cout<<"Max excitation difference: "<<maxExDiff<<" MeV"<<std::endl;
+	std::cout<<"Max CM angle difference: "<<maxAngleDiff<<" rad"<<std::endl;
+
+	return 0;
+}
@@ -0,0 +1,730 @@
+/*
+MassData.h
+AME atomic masses compiled into SabreRecon. Generated by etc/make_mass_data.py from etc/mass.txt -- do not edit by hand.
+Isotopes of each Z are stored contiguously by A starting at firstIndex[Z] (missing A hold zeros), so an isotope is found
+with a single index calculation. Masses are split as in the AME file: integer part (u) and remainder (micro-u).
+*/
+#ifndef MASS_DATA_H
+#define MASS_DATA_H
+
+namespace SabreRecon {
+
+	namespace MassData {
+
+		struct AtomicMass
+		{
+			double u;
+			double microU;
+		};
+
+		inline constexpr int maxZ = 110;
+		inline constexpr int nIsotopes = 2569;
+
+		inline constexpr const char* symbols[maxZ+1] =
+		{
+			"n", "H", "He", "Li", "Be", "B", "C", "N", "O", "F", "Ne", "Na",
+			"Mg", "Al", "Si", "P", "S", "Cl", "Ar", "K", "Ca", "Sc", "Ti", "V",
+			"Cr", "Mn", "Fe", "Co", "Ni", "Cu", "Zn", "Ga", "Ge", "As", "Se", "Br",
+			"Kr", "Rb", "Sr", "Y", "Zr", "Nb", "Mo", "Tc", "Ru", "Rh", "Pd", "Ag",
+			"Cd", "In", "Sn", "Sb", "Te", "I", "Xe", "Cs", "Ba", "La", "Ce", "Pr",
+			"Nd", "Pm", "Sm", "Eu", "Gd", "Tb", "Dy", "Ho", "Er", "Tm", "Yb", "Lu",
+			"Hf", "Ta", "W", "Re", "Os", "Ir", "Pt", "Au", "Hg", "Tl", "Pb", "Bi",
+			"Po", "At", "Rn", "Fr", "Ra", "Ac", "Th", "Pa", "U", "Np", "Pu", "Am",
+			"Cm", "Bk", "Cf", "Es", "Fm", "Md", "No", "Lr", "Rf", "Db", "Sg", "",
+			"Hs", "", "Ds"
+		};
+
+		inline constexpr int firstIndex[maxZ+1] =
+		{
+			0, 1, 7, 15, 25, 36, 49, 64, 78, 93, 109, 126,
+			144, 163, 179, 197, 214, 232, 250, 269, 288, 307, 326, 344,
+			363, 383, 403, 423, 444, 465, 489, 514, 537, 561, 584, 609,
+			634, 661, 688, 716, 743, 770, 798, 825, 854, 882, 912, 942,
+			972, 1006, 1039, 1075, 1110, 1146, 1181, 1219, 1256, 1292, 1320, 1346,
+			1374, 1402, 1429, 1456, 1483, 1507, 1534, 1561, 1589, 1616, 1646, 1674,
+			1705, 1736, 1768, 1800, 1833, 1866, 1899, 1934, 1967, 2004, 2042, 2080,
+			2115, 2152, 2186, 2223, 2260, 2294, 2326, 2356, 2383, 2409, 2433, 2452,
+			2469, 2488, 2497, 2515, 2524, 2536, 2544, 2552, 2554, 2560, 2561, 2564,
+			2564, 2567, 2567
+		};
+
+		inline constexpr int minA[maxZ+1] =
+		{
+			1, 1, 3, 4, 6, 7, 8, 10, 12, 14, 15, 17,
+			19, 23, 24, 27, 28, 29, 30, 35, 36, 39, 40, 43,
+			45, 47, 49, 51, 53, 55, 58, 61, 63, 65, 67, 69,
+			71, 74, 75, 79, 81, 83, 85, 87, 90, 92, 94, 96,
+			98, 100, 100, 104, 105, 108, 109, 112, 114, 124, 126, 128,
+			130, 133, 135, 137, 140, 140, 143, 144, 146, 147, 151, 153,
+			156, 157, 160, 161, 164, 167, 168, 171, 172, 176, 178, 184,
+			186, 191, 193, 197, 201, 205, 208, 212, 215, 219, 228, 229,
+			233, 243, 237, 247, 246, 251, 252, 255, 256, 259, 260, 0,
+			264, 0, 269
+		};
+
+		inline constexpr int nA[maxZ+1] =
+		{
+			1, 6, 8, 10, 11, 13, 15, 14, 15, 16, 17, 18,
+			19, 16, 18, 17, 18, 18, 19, 19, 19, 19, 18, 19,
+			20, 20, 20, 21, 21, 24, 25, 23, 24, 23, 25, 25,
+			27, 27, 28, 27, 27, 28, 27, 29, 28, 30, 30, 30,
+			34, 33, 36, 35, 36, 35, 38, 37, 36, 28, 26, 28,
+			28, 27, 27, 27, 24, 27, 27, 28, 27, 30, 28, 31,
+			31, 32, 32, 33, 33, 33, 35, 33, 37, 38, 38, 35,
+			37, 34, 37, 37, 34, 32, 30, 27, 26, 24, 19, 17,
+			19, 9, 18, 9, 12, 8, 8, 2, 6, 1, 3, 0,
+			3, 0, 2
+		};
+
+		inline constexpr AtomicMass atomicMasses[nIsotopes] =
+		{
+			{1.0, 8664.91582}, {1.0, 7825.03224}, {2.0, 14101.77811}, {3.0, 16049.28199},
+			{4.0, 26431.868}, {5.0, 35311.493}, {6.0, 44955.437}, {3.0, 16029.32265},
+			{4.0, 2603.25413}, {5.0, 12057.224}, {6.0, 18885.891}, {7.0, 27990.654},
+			{8.0, 33934.39}, {9.0, 43946.419}, {10.0, 52815.308}, {4.0, 27185.562},
+			{5.0, 12537.8}, {6.0, 15122.88742}, {7.0, 16003.43666}, {8.0, 22486.246},
+			{9.0, 26790.191}, {10.0, 35483.453}, {11.0, 43723.581}, {12.0, 52613.941},
+			{13.0, 61171.503}, {6.0, 19726.409}, {7.0, 16928.717}, {8.0, 5305.102},
+			{9.0, 12183.066}, {10.0, 13534.695}, {11.0, 21661.081}, {12.0, 26922.083},
+			{13.0, 36134.507}, {14.0, 42892.92}, {15.0, 53490.215}, {16.0, 61672.036},
+			{7.0, 29712.0}, {8.0, 24607.316}, {9.0, 13329.649}, {10.0, 12936.862},
+			{11.0, 9305.166}, {12.0, 14352.638}, {13.0, 17779.981}, {14.0, 25404.012},
+			{15.0, 31087.953}, {16.0, 39841.92}, {17.0, 46931.399}, {18.0, 55601.682},
+			{19.0, 64166.0}, {8.0, 37643.042}, {9.0, 31037.207}, {10.0, 16853.218},
+			{11.0, 11432.597}, {12.0, 0.0}, {13.0, 3354.83521}, {14.0, 3241.98843},
+			{15.0, 10599.256}, {16.0, 14701.256}, {17.0, 22578.672}, {18.0, 26751.932},
+			{19.0, 34797.596}, {20.0, 40261.732}, {0.0, 0.0}, {22.0, 57553.99},
+			{10.0, 41653.543}, {11.0, 26090.945}, {12.0, 18613.182}, {13.0, 5738.609},
+			{14.0, 3074.00446}, {15.0, 108.89894}, {16.0, 6101.925}, {17.0, 8448.877},
+			{18.0, 14077.565}, {19.0, 17022.419}, {20.0, 23367.295}, {21.0, 27087.573},
+			{22.0, 34100.918}, {23.0, 39421.0}, {12.0, 34261.747}, {13.0, 24815.437},
+			{14.0, 8596.706}, {15.0, 3065.618}, {15.0, 994914.6196}, {16.0, 999131.75664},
+			{17.0, 999159.61284}, {19.0, 3577.97}, {20.0, 4075.358}, {21.0, 8654.95},
+			{22.0, 9965.746}, {23.0, 15696.686}, {24.0, 19861.0}, {25.0, 29338.919},
+			{26.0, 37210.155}, {14.0, 34315.199}, {15.0, 17785.139}, {16.0, 11465.723},
+			{17.0, 2095.238}, {18.0, 937.325}, {18.0, 998403.16288}, {19.0, 999981.252},
+			{20.0, 999948.894}, {22.0, 2998.809}, {23.0, 3526.874}, {24.0, 8099.37},
+			{25.0, 12167.727}, {26.0, 20020.392}, {27.0, 27322.0}, {28.0, 36223.095},
+			{29.0, 43103.0}, {15.0, 43172.98}, {16.0, 25750.864}, {17.0, 17713.959},
+			{18.0, 5708.693}, {19.0, 1880.903}, {19.0, 992440.17619}, {20.0, 993846.685},
+			{21.0, 991385.109}, {22.0, 994466.9}, {23.0, 993610.645}, {24.0, 997814.799},
+			{26.0, 516.496}, {27.0, 7569.462}, {28.0, 12130.767}, {29.0, 19753.0},
+			{30.0, 24992.235}, {31.0, 33474.816}, {17.0, 37760.0}, {18.0, 26879.386},
+			{19.0, 13880.272}, {20.0, 7354.426}, {20.0, 997654.702}, {21.0, 994437.418},
+			{22.0, 989769.28199}, {23.0, 990963.011}, {24.0, 989953.973}, {25.0, 992634.649},
+			{26.0, 994076.408}, {27.0, 998939.0}, {29.0, 2877.092}, {30.0, 9097.932},
+			{31.0, 13146.656}, {32.0, 20011.026}, {33.0, 25529.0}, {34.0, 34010.0},
+			{19.0, 34169.182}, {20.0, 18763.075}, {21.0, 11705.764}, {21.0, 999570.654},
+			{22.0, 994123.941}, {23.0, 985041.697}, {24.0, 985836.964}, {25.0, 982592.971},
+			{26.0, 984340.628}, {27.0, 983876.606}, {28.0, 988617.393}, {29.0, 990462.826},
+			{30.0, 996648.232}, {31.0, 999110.139}, {33.0, 5327.245}, {34.0, 8935.481},
+			{35.0, 16790.0}, {36.0, 21879.0}, {37.0, 30286.265}, {23.0, 7244.351},
+			{23.0, 999947.541}, {24.0, 990428.306}, {25.0, 986891.863}, {26.0, 981538.408},
+			{27.0, 981910.087}, {28.0, 980453.164}, {29.0, 982968.388}, {30.0, 983949.756},
+			{31.0, 988084.339}, {32.0, 990877.687}, {33.0, 996779.057}, {34.0, 999759.817},
+			{36.0, 6388.0}, {37.0, 10531.0}, {38.0, 17402.0}, {24.0, 11535.441},
+			{25.0, 4108.801}, {25.0, 992333.804}, {26.0, 986704.688}, {27.0, 976926.53499},
+			{28.0, 976494.66525}, {29.0, 973770.136}, {30.0, 975363.194}, {31.0, 974151.539},
+			{32.0, 977976.964}, {33.0, 978575.437}, {34.0, 984550.134}, {35.0, 986649.271},
+			{36.0, 992945.191}, {37.0, 995523.0}, {39.0, 2491.0}, {40.0, 5829.0},
+			{41.0, 13011.0}, {26.0, 999224.409}, {27.0, 992326.585}, {28.0, 981800.368},
+			{29.0, 978313.489}, {30.0, 973761.99863}, {31.0, 973907.643}, {32.0, 971725.694},
+			{33.0, 973645.887}, {34.0, 973314.053}, {35.0, 978259.619}, {36.0, 979606.956},
+			{37.0, 984303.105}, {38.0, 986285.865}, {39.0, 991288.865}, {40.0, 994654.0},
+			{42.0, 1084.0}, {43.0, 5024.0}, {28.0, 4372.766}, {28.0, 996611.448},
+			{29.0, 984906.769}, {30.0, 979557.007}, {31.0, 972071.17443}, {32.0, 971458.90985},
+			{33.0, 967867.012}, {34.0, 969032.322}, {35.0, 967080.699}, {36.0, 971125.507},
+			{37.0, 971163.31}, {38.0, 975133.852}, {39.0, 975482.562}, {40.0, 979593.451},
+			{41.0, 981065.1}, {42.0, 986907.635}, {43.0, 990118.848}, {44.0, 995717.0},
+			{29.0, 14130.178}, {0.0, 0.0}, {30.0, 992448.098}, {31.0, 985684.637},
+			{32.0, 977451.989}, {33.0, 973762.491}, {34.0, 968852.694}, {35.0, 968306.822},
+			{36.0, 965902.584}, {37.0, 968010.418}, {38.0, 968008.162}, {39.0, 970415.469},
+			{40.0, 970684.525}, {41.0, 973342.0}, {42.0, 974063.7}, {43.0, 978116.312},
+			{44.0, 980394.353}, {45.0, 985121.323}, {30.0, 22470.511}, {0.0, 0.0},
+			{31.0, 997637.826}, {32.0, 989925.547}, {33.0, 980270.093}, {34.0, 975257.721},
+			{35.0, 967545.105}, {36.0, 966776.314}, {37.0, 962732.104}, {38.0, 964313.039},
+			{39.0, 962383.12378}, {40.0, 964500.571}, {41.0, 963045.736}, {42.0, 965636.055},
+			{43.0, 964923.816}, {44.0, 968039.733}, {45.0, 968037.446}, {46.0, 972768.114},
+			{47.0, 976080.0}, {34.0, 988005.407}, {35.0, 981302.01}, {36.0, 973375.889},
+			{37.0, 969081.116}, {38.0, 963706.48661}, {39.0, 963998.166}, {40.0, 961825.25796},
+			{41.0, 962402.306}, {42.0, 960734.703}, {43.0, 961586.986}, {44.0, 960691.493},
+			{45.0, 961981.586}, {46.0, 961661.614}, {47.0, 965341.186}, {48.0, 968210.755},
+			{49.0, 972380.017}, {50.0, 975827.867}, {51.0, 981602.0}, {52.0, 986800.0},
+			{35.0, 993074.406}, {36.0, 985897.852}, {37.0, 976319.226}, {38.0, 970710.813},
+			{39.0, 962590.865}, {40.0, 962277.921}, {41.0, 958617.828}, {42.0, 958766.43},
+			{43.0, 955481.543}, {44.0, 956186.326}, {45.0, 953687.988}, {46.0, 954541.394},
+			{47.0, 952522.904}, {48.0, 955662.875}, {49.0, 957499.217}, {50.0, 960995.665},
+			{51.0, 963213.648}, {52.0, 968451.0}, {53.0, 972989.0}, {38.0, 984784.97},
+			{39.0, 977967.292}, {40.0, 969251.104}, {41.0, 965516.522}, {42.0, 961150.472},
+			{43.0, 959402.867}, {44.0, 955907.503}, {45.0, 955167.485}, {46.0, 952402.704},
+			{47.0, 952223.157}, {48.0, 950014.423}, {49.0, 952176.415}, {50.0, 953592.095},
+			{51.0, 956582.351}, {52.0, 958231.821}, {53.0, 963616.62}, {54.0, 967622.601},
+			{55.0, 973320.0}, {56.0, 977460.0}, {39.0, 990498.721}, {40.0, 983148.0},
+			{41.0, 973049.022}, {42.0, 968522.521}, {43.0, 959689.951}, {44.0, 958121.211},
+			{45.0, 952626.856}, {46.0, 951757.752}, {47.0, 947940.932}, {48.0, 947864.627},
+			{49.0, 944785.839}, {50.0, 946609.6}, {51.0, 946891.96}, {52.0, 949724.785},
+			{53.0, 951022.786}, {54.0, 955267.465}, {55.0, 957788.19}, {56.0, 963590.068},
+			{42.0, 980766.0}, {43.0, 974110.0}, {44.0, 965768.951}, {45.0, 960197.971},
+			{46.0, 954904.038}, {47.0, 952251.229}, {48.0, 948510.746}, {49.0, 947155.845},
+			{50.0, 943956.867}, {51.0, 944772.839}, {52.0, 944335.593}, {53.0, 946437.472},
+			{54.0, 947241.114}, {55.0, 950450.694}, {56.0, 952320.197}, {57.0, 956626.932},
+			{58.0, 959385.659}, {59.0, 964313.29}, {60.0, 967250.0}, {44.0, 979050.0},
+			{45.0, 968360.97}, {46.0, 962895.544}, {47.0, 954028.667}, {48.0, 951332.955},
+			{49.0, 946041.443}, {50.0, 944764.652}, {51.0, 940504.992}, {52.0, 940646.961},
+			{53.0, 938878.012}, {54.0, 940837.289}, {55.0, 940649.107}, {56.0, 943612.409},
+			{57.0, 944184.502}, {58.0, 948377.81}, {59.0, 949898.146}, {60.0, 954400.963},
+			{61.0, 956097.451}, {62.0, 961344.384}, {63.0, 964058.0}, {46.0, 975774.0},
+			{47.0, 968549.085}, {48.0, 959612.585}, {49.0, 954237.391}, {50.0, 948208.065},
+			{51.0, 945563.488}, {52.0, 941287.742}, {53.0, 940356.429}, {54.0, 938043.172},
+			{55.0, 938902.947}, {56.0, 938285.968}, {57.0, 940066.646}, {58.0, 940391.113},
+			{59.0, 943136.576}, {60.0, 944452.544}, {61.0, 947907.386}, {62.0, 949664.675},
+			{63.0, 953849.37}, {64.0, 956019.75}, {65.0, 960546.834}, {48.0, 973429.0},
+			{49.0, 962988.0}, {50.0, 956840.779}, {51.0, 948115.217}, {52.0, 945305.574},
+			{53.0, 939608.306}, {54.0, 938291.283}, {55.0, 934935.617}, {56.0, 935392.134},
+			{57.0, 933273.738}, {58.0, 934873.649}, {59.0, 934070.411}, {60.0, 936746.244},
+			{61.0, 936791.812}, {62.0, 940272.7}, {63.0, 940987.763}, {64.0, 945015.324},
+			{65.0, 946249.96}, {66.0, 951035.482}, {67.0, 953314.875}, {50.0, 970647.0},
+			{51.0, 963112.0}, {52.0, 954203.217}, {53.0, 948459.192}, {54.0, 941996.531},
+			{55.0, 939838.15}, {56.0, 936289.913}, {57.0, 935751.429}, {58.0, 933193.656},
+			{59.0, 933815.667}, {60.0, 932476.145}, {61.0, 934058.317}, {62.0, 933599.744},
+			{63.0, 935810.291}, {64.0, 936462.073}, {65.0, 939442.945}, {66.0, 940609.628},
+			{67.0, 944250.135}, {68.0, 946023.102}, {0.0, 0.0}, {70.0, 952366.923},
+			{52.0, 968190.0}, {53.0, 957833.0}, {54.0, 951329.961}, {55.0, 942127.872},
+			{56.0, 939791.525}, {57.0, 935341.78}, {58.0, 934345.571}, {59.0, 930785.256},
+			{60.0, 931054.945}, {61.0, 928344.871}, {62.0, 929669.139}, {63.0, 927966.341},
+			{64.0, 930084.697}, {65.0, 929139.334}, {66.0, 931569.414}, {67.0, 931868.789},
+			{68.0, 935610.268}, {69.0, 936431.303}, {70.0, 940518.964}, {71.0, 941785.926},
+			{72.0, 946206.683}, {54.0, 966038.0}, {55.0, 958515.0}, {56.0, 949211.819},
+			{57.0, 944532.413}, {58.0, 939496.844}, {59.0, 937363.916}, {60.0, 933457.371},
+			{61.0, 932594.921}, {62.0, 929597.236}, {63.0, 929763.857}, {64.0, 927789.487},
+			{65.0, 928868.814}, {66.0, 927729.526}, {67.0, 929610.889}, {68.0, 929429.268},
+			{69.0, 932392.079}, {70.0, 932676.832}, {71.0, 935820.307}, {72.0, 936674.378},
+			{73.0, 939874.862}, {74.0, 941522.606}, {75.0, 945275.025}, {0.0, 0.0},
+			{77.0, 952230.0}, {57.0, 954590.428}, {58.0, 949312.017}, {59.0, 941841.45},
+			{60.0, 939506.96}, {61.0, 934333.477}, {62.0, 933211.167}, {63.0, 929141.772},
+			{64.0, 929240.532}, {65.0, 926033.704}, {66.0, 927127.482}, {67.0, 924844.291},
+			{68.0, 926550.418}, {69.0, 925319.181}, {70.0, 927719.58}, {71.0, 926842.807},
+			{72.0, 929582.582}, {73.0, 929407.262}, {74.0, 932840.246}, {75.0, 933114.957},
+			{76.0, 936887.199}, {77.0, 938289.205}, {78.0, 942638.068}, {79.0, 944552.93},
+			{80.0, 950402.619}, {81.0, 954574.099}, {60.0, 949398.859}, {61.0, 944189.757},
+			{62.0, 939294.195}, {63.0, 936840.365}, {64.0, 932734.395}, {65.0, 931589.832},
+			{66.0, 928202.384}, {67.0, 927980.221}, {68.0, 925573.531}, {69.0, 926021.917},
+			{70.0, 924702.536}, {71.0, 926367.434}, {72.0, 925174.682}, {73.0, 926945.726},
+			{74.0, 926500.246}, {75.0, 928827.625}, {76.0, 929154.3}, {77.0, 931608.845},
+			{78.0, 932852.301}, {79.0, 936420.774}, {80.0, 938133.842}, {81.0, 943176.533},
+			{82.0, 947120.301}, {62.0, 949628.0}, {63.0, 941689.913}, {64.0, 939368.137},
+			{65.0, 933862.126}, {66.0, 932733.62}, {67.0, 928095.308}, {68.0, 927964.471},
+			{69.0, 924248.706}, {70.0, 924952.284}, {71.0, 922075.826}, {72.0, 923458.956},
+			{73.0, 921177.762}, {74.0, 922858.371}, {75.0, 921402.726}, {76.0, 923549.844},
+			{77.0, 922852.912}, {78.0, 925360.129}, {79.0, 925350.774}, {80.0, 928832.942},
+			{81.0, 929774.033}, {82.0, 934539.101}, {83.0, 937575.091}, {84.0, 942969.659},
+			{85.0, 946967.0}, {64.0, 949611.0}, {65.0, 944148.779}, {66.0, 939251.111},
+			{67.0, 936774.13}, {68.0, 932246.294}, {69.0, 930926.151}, {70.0, 927113.758},
+			{71.0, 926752.295}, {72.0, 923829.089}, {73.0, 923928.598}, {74.0, 921594.562},
+			{75.0, 922392.01}, {76.0, 920647.564}, {77.0, 921827.795}, {78.0, 920948.445},
+			{79.0, 922474.548}, {80.0, 922132.29}, {81.0, 924738.733}, {82.0, 925206.901},
+			{83.0, 929303.291}, {84.0, 932163.659}, {85.0, 936701.533}, {86.0, 940291.718},
+			{66.0, 949994.0}, {67.0, 941825.239}, {68.0, 939414.847}, {69.0, 933515.523},
+			{70.0, 932209.432}, {71.0, 927140.507}, {72.0, 926754.883}, {73.0, 922475.935},
+			{74.0, 922522.871}, {75.0, 919213.704}, {76.0, 919914.15}, {77.0, 917309.243},
+			{78.0, 918499.251}, {79.0, 916521.785}, {80.0, 917993.044}, {81.0, 916699.537},
+			{82.0, 919118.609}, {83.0, 918466.762}, {84.0, 922260.759}, {85.0, 924311.733},
+			{86.0, 928688.618}, {87.0, 931417.491}, {88.0, 936669.059}, {89.0, 940096.0},
+			{90.0, 945700.0}, {68.0, 950338.413}, {69.0, 944792.323}, {70.0, 939342.156},
+			{71.0, 936594.607}, {72.0, 931671.621}, {73.0, 929910.281}, {74.0, 925810.57},
+			{75.0, 924541.577}, {76.0, 921379.194}, {77.0, 921145.859}, {78.0, 918337.601},
+			{79.0, 918529.81}, {80.0, 916288.206}, {81.0, 916801.76}, {82.0, 915175.289},
+			{83.0, 916496.419}, {84.0, 915645.759}, {85.0, 918805.433}, {86.0, 920674.018},
+			{87.0, 924083.291}, {88.0, 926704.559}, {89.0, 931292.85}, {90.0, 934398.618},
+			{91.0, 939631.597}, {92.0, 943220.0}, {70.0, 950265.696}, {71.0, 942092.407},
+			{72.0, 939289.195}, {73.0, 933084.017}, {74.0, 930945.746}, {75.0, 925910.726},
+			{76.0, 924670.0}, {77.0, 920366.341}, {78.0, 920082.945}, {79.0, 916378.048},
+			{80.0, 916589.714}, {81.0, 913481.1552}, {82.0, 914126.518}, {83.0, 911497.72863},
+			{84.0, 912527.262}, {85.0, 910610.62627}, {86.0, 913354.759}, {87.0, 914447.881},
+			{88.0, 917835.45}, {89.0, 919527.93}, {90.0, 923806.31}, {91.0, 926173.094},
+			{92.0, 931147.174}, {93.0, 934140.454}, {94.0, 939710.923}, {95.0, 943016.618},
+			{96.0, 949088.784}, {73.0, 944265.868}, {74.0, 938573.201}, {75.0, 935073.032},
+			{76.0, 930401.6}, {77.0, 928141.868}, {78.0, 923989.864}, {79.0, 922516.444},
+			{80.0, 918993.927}, {81.0, 918209.024}, {82.0, 915114.182}, {83.0, 914375.225},
+			{84.0, 911789.7376}, {85.0, 911167.443}, {86.0, 909180.531}, {87.0, 911315.591},
+			{88.0, 912278.137}, {89.0, 914798.803}, {90.0, 916537.265}, {91.0, 919728.481},
+			{92.0, 922039.325}, {93.0, 926394.818}, {94.0, 929262.568}, {95.0, 934133.393},
+			{96.0, 937177.118}, {97.0, 941632.317}, {98.0, 945119.192}, {99.0, 950351.731},
+			{74.0, 949952.77}, {75.0, 941762.761}, {76.0, 937945.455}, {77.0, 932179.98},
+			{78.0, 929707.664}, {79.0, 924517.54}, {80.0, 923211.394}, {81.0, 918399.847},
+			{82.0, 917554.374}, {83.0, 913419.12}, {84.0, 912932.043}, {85.0, 909260.72631},
+			{86.0, 908877.49615}, {87.0, 905612.25561}, {88.0, 907450.808}, {89.0, 907730.885},
+			{90.0, 910195.958}, {91.0, 911038.224}, {92.0, 914024.311}, {93.0, 915355.643},
+			{94.0, 919355.84}, {95.0, 921712.692}, {96.0, 926374.776}, {97.0, 928691.86},
+			{98.0, 932880.511}, {99.0, 935779.615}, {100.0, 940606.266}, {101.0, 944004.68},
+			{78.0, 937930.0}, {79.0, 934354.755}, {80.0, 929454.283}, {81.0, 926930.188},
+			{82.0, 922484.025}, {83.0, 920671.061}, {84.0, 916433.039}, {85.0, 914886.098},
+			{86.0, 910876.102}, {87.0, 909501.276}, {88.0, 905841.205}, {89.0, 907144.8},
+			{90.0, 907298.066}, {91.0, 908945.745}, {92.0, 909578.422}, {93.0, 911592.063},
+			{94.0, 912818.711}, {95.0, 915902.953}, {96.0, 918280.286}, {97.0, 922388.36},
+			{98.0, 924154.288}, {99.0, 927721.063}, {100.0, 930154.138}, {101.0, 934327.889},
+			{102.0, 937243.208}, {0.0, 0.0}, {104.0, 944959.0}, {80.0, 938314.0},
+			{81.0, 931689.0}, {82.0, 929240.925}, {83.0, 923325.662}, {84.0, 921443.198},
+			{85.0, 916296.815}, {86.0, 914817.339}, {87.0, 910220.709}, {88.0, 908882.332},
+			{89.0, 904698.758}, {90.0, 905640.223}, {91.0, 905035.322}, {92.0, 906470.646},
+			{93.0, 906312.524}, {94.0, 908040.267}, {95.0, 908277.621}, {96.0, 910957.386},
+			{97.0, 912735.124}, {98.0, 916670.835}, {99.0, 918005.444}, {100.0, 921453.11},
+			{101.0, 923147.431}, {102.0, 927197.24}, {103.0, 929442.315}, {104.0, 934014.89},
+			{105.0, 937144.0}, {106.0, 941621.0}, {82.0, 938211.0}, {83.0, 934279.0},
+			{84.0, 928845.837}, {85.0, 925781.535}, {86.0, 920692.472}, {87.0, 918224.287},
+			{88.0, 913445.272}, {89.0, 911259.204}, {90.0, 906990.274}, {91.0, 907188.568},
+			{92.0, 906373.161}, {93.0, 907278.992}, {94.0, 906831.115}, {95.0, 908101.591},
+			{96.0, 908098.414}, {97.0, 910332.65}, {98.0, 911609.371}, {99.0, 914333.963},
+			{100.0, 915306.496}, {101.0, 918083.697}, {102.0, 919453.403}, {103.0, 922899.115},
+			{104.0, 924942.564}, {105.0, 928927.768}, {106.0, 931589.672}, {107.0, 936074.988},
+			{108.0, 939141.0}, {109.0, 943843.0}, {84.0, 938260.737}, {85.0, 931174.817},
+			{86.0, 928196.201}, {87.0, 921967.781}, {88.0, 919468.15}, {89.0, 913931.272},
+			{90.0, 911745.195}, {91.0, 906807.155}, {92.0, 906808.773}, {93.0, 905083.592},
+			{94.0, 905837.442}, {95.0, 904674.774}, {96.0, 906016.903}, {97.0, 905403.608},
+			{98.0, 907707.298}, {99.0, 907467.976}, {100.0, 910337.641}, {101.0, 910288.138},
+			{102.0, 913085.14}, {103.0, 913740.756}, {104.0, 916975.159}, {105.0, 918266.218},
+			{106.0, 922112.692}, {107.0, 924040.367}, {108.0, 928431.106}, {109.0, 930710.68},
+			{110.0, 935652.016}, {86.0, 938067.187}, {87.0, 933782.381}, {88.0, 927648.65},
+			{89.0, 924073.921}, {90.0, 918424.975}, {91.0, 915269.779}, {92.0, 910245.149},
+			{93.0, 909652.325}, {94.0, 907652.287}, {95.0, 907866.681}, {96.0, 906360.723},
+			{97.0, 907211.205}, {98.0, 906249.678}, {99.0, 907652.711}, {100.0, 907305.26},
+			{101.0, 909207.275}, {102.0, 909174.008}, {103.0, 911428.905}, {104.0, 911657.952},
+			{105.0, 914356.697}, {106.0, 915458.485}, {107.0, 918493.541}, {108.0, 920254.156},
+			{109.0, 923741.312}, {110.0, 925899.016}, {111.0, 929941.644}, {112.0, 932569.033},
+			{113.0, 937090.0}, {114.0, 939538.0}, {89.0, 930344.379}, {90.0, 926741.532},
+			{91.0, 920234.375}, {92.0, 917104.444}, {93.0, 911342.863}, {94.0, 910404.42},
+			{95.0, 907588.914}, {96.0, 907545.779}, {97.0, 905286.713}, {98.0, 905930.278},
+			{99.0, 904210.452}, {100.0, 905573.075}, {101.0, 904340.3}, {102.0, 906314.833},
+			{103.0, 905425.36}, {104.0, 907745.525}, {105.0, 907328.203}, {106.0, 909969.885},
+			{107.0, 910185.841}, {108.0, 913323.756}, {109.0, 914038.548}, {110.0, 917567.616},
+			{111.0, 918806.972}, {112.0, 922846.396}, {113.0, 924613.78}, {114.0, 928942.393},
+			{115.0, 931219.193}, {116.0, 936135.0}, {91.0, 932367.694}, {92.0, 925912.781},
+			{93.0, 921730.453}, {94.0, 915897.895}, {95.0, 914451.71}, {96.0, 911327.876},
+			{97.0, 910707.74}, {98.0, 908124.69}, {99.0, 908114.141}, {100.0, 906158.905},
+			{101.0, 906834.27}, {102.0, 905494.068}, {103.0, 906645.295}, {104.0, 905687.806},
+			{105.0, 907285.901}, {106.0, 906747.974}, {107.0, 908714.688}, {108.0, 908749.326},
+			{109.0, 911079.742}, {110.0, 911642.531}, {111.0, 914404.705}, {112.0, 915439.567},
+			{113.0, 918721.296}, {114.0, 920310.993}, {115.0, 924061.645}, {116.0, 926035.623},
+			{117.0, 930340.443}, {118.0, 932556.952}, {0.0, 0.0}, {120.0, 939613.0},
+			{93.0, 929036.292}, {94.0, 924888.512}, {95.0, 918213.744}, {96.0, 916471.987},
+			{97.0, 912698.337}, {98.0, 911773.29}, {99.0, 908520.315}, {100.0, 908284.828},
+			{101.0, 905632.058}, {102.0, 906110.84}, {103.0, 904030.401}, {104.0, 905079.487},
+			{105.0, 903480.293}, {106.0, 905128.064}, {107.0, 903891.805}, {108.0, 905950.574},
+			{109.0, 905172.868}, {110.0, 907690.347}, {111.0, 907329.986}, {112.0, 910261.267},
+			{113.0, 910368.78}, {114.0, 913658.718}, {115.0, 914297.21}, {116.0, 917954.944},
+			{117.0, 919066.847}, {118.0, 923340.459}, {119.0, 924551.258}, {120.0, 928950.343},
+			{121.0, 930631.694}, {122.0, 935126.0}, {95.0, 930743.906}, {96.0, 923965.326},
+			{97.0, 921559.972}, {98.0, 917645.768}, {99.0, 916115.445}, {100.0, 912683.953},
+			{101.0, 911704.54}, {102.0, 908960.56}, {103.0, 908623.725}, {104.0, 906525.607},
+			{105.0, 906663.507}, {106.0, 905091.531}, {107.0, 905950.266}, {108.0, 904755.773},
+			{109.0, 906110.719}, {110.0, 905296.816}, {111.0, 907048.55}, {112.0, 906572.858},
+			{113.0, 908823.031}, {114.0, 908767.363}, {115.0, 911386.812}, {116.0, 911773.974},
+			{117.0, 914595.487}, {118.0, 915570.293}, {119.0, 918784.767}, {120.0, 920125.282},
+			{121.0, 923664.448}, {122.0, 925337.062}, {123.0, 928931.229}, {124.0, 930735.0},
+			{97.0, 927389.317}, {98.0, 924925.847}, {99.0, 920348.82}, {100.0, 918586.211},
+			{101.0, 914481.799}, {102.0, 913416.923}, {103.0, 909856.23}, {104.0, 909463.895},
+			{105.0, 906459.797}, {106.0, 906612.108}, {107.0, 904183.587}, {108.0, 904986.698},
+			{109.0, 903007.46}, {110.0, 904183.766}, {111.0, 902763.883}, {112.0, 904408.097},
+			{113.0, 903364.99}, {114.0, 905437.417}, {115.0, 904763.23}, {116.0, 907226.038},
+			{117.0, 906921.955}, {118.0, 909846.903}, {119.0, 909868.067}, {120.0, 912963.663},
+			{121.0, 913459.052}, {122.0, 916892.453}, {123.0, 917657.363}, {124.0, 921257.577},
+			{125.0, 922429.127}, {126.0, 926196.624}, {127.0, 927812.857}, {128.0, 932304.399},
+			{129.0, 934387.566}, {130.0, 940720.0}, {99.0, 930957.18}, {0.0, 0.0},
+			{101.0, 924105.916}, {102.0, 919878.613}, {103.0, 918214.54}, {104.0, 914502.324},
+			{105.0, 913463.603}, {106.0, 910290.071}, {107.0, 909693.655}, {108.0, 907149.685},
+			{109.0, 907170.665}, {110.0, 905107.233}, {111.0, 905538.704}, {112.0, 904060.448},
+			{113.0, 904916.402}, {114.0, 903878.773}, {115.0, 905259.992}, {116.0, 904515.712},
+			{117.0, 906356.659}, {118.0, 905850.944}, {119.0, 907966.805}, {120.0, 907851.286},
+			{121.0, 910280.966}, {122.0, 910433.826}, {123.0, 913182.263}, {124.0, 913604.591},
+			{125.0, 916507.344}, {126.0, 917448.546}, {127.0, 920401.053}, {128.0, 921805.486},
+			{129.0, 924977.288}, {130.0, 926972.122}, {131.0, 932998.449}, {99.0, 938504.196},
+			{100.0, 935259.244}, {101.0, 930289.53}, {102.0, 928101.962}, {103.0, 923105.197},
+			{104.0, 921268.423}, {105.0, 916957.396}, {106.0, 915713.651}, {107.0, 911894.292},
+			{108.0, 911292.843}, {109.0, 907844.835}, {110.0, 907741.126}, {111.0, 904824.877},
+			{112.0, 905175.845}, {113.0, 902780.132}, {114.0, 903344.697}, {115.0, 901742.824},
+			{116.0, 902954.017}, {117.0, 901606.609}, {118.0, 903311.216}, {119.0, 902201.873},
+			{120.0, 904242.792}, {121.0, 903444.001}, {122.0, 905725.446}, {123.0, 905276.692},
+			{124.0, 907786.442}, {125.0, 907658.836}, {126.0, 910390.401}, {127.0, 910507.197},
+			{128.0, 913482.102}, {129.0, 913974.533}, {130.0, 917053.066}, {131.0, 917823.902},
+			{132.0, 923913.756}, {133.0, 928680.433}, {134.0, 934908.605}, {103.0, 936474.502},
+			{104.0, 931276.549}, {105.0, 928637.982}, {106.0, 924150.624}, {107.0, 922226.734},
+			{108.0, 918141.204}, {109.0, 916854.286}, {110.0, 913218.189}, {111.0, 912399.903},
+			{112.0, 909374.652}, {113.0, 909289.191}, {114.0, 906598.0}, {115.0, 906792.583},
+			{116.0, 904841.535}, {117.0, 905532.174}, {118.0, 903945.512}, {119.0, 905079.624},
+			{120.0, 903810.093}, {121.0, 905168.074}, {122.0, 904214.016}, {123.0, 905935.789},
+			{124.0, 905252.987}, {125.0, 907253.036}, {126.0, 906924.277}, {127.0, 909145.645},
+			{128.0, 909146.696}, {129.0, 911662.688}, {130.0, 911989.341}, {131.0, 914508.015},
+			{132.0, 915272.13}, {133.0, 920535.675}, {134.0, 925184.357}, {135.0, 930749.011},
+			{136.0, 935522.522}, {137.0, 941792.0}, {104.0, 943304.508}, {105.0, 937498.526},
+			{106.0, 935008.356}, {107.0, 929380.471}, {108.0, 927304.534}, {109.0, 922458.104},
+			{110.0, 921000.589}, {111.0, 916727.85}, {112.0, 915891.0}, {113.0, 912089.0},
+			{114.0, 911902.0}, {115.0, 908460.0}, {116.0, 908646.313}, {117.0, 905853.839},
+			{118.0, 906407.148}, {119.0, 904059.514}, {120.0, 904942.488}, {121.0, 903043.434},
+			{122.0, 904269.747}, {123.0, 902817.064}, {124.0, 904429.9}, {125.0, 903310.866},
+			{126.0, 905225.714}, {127.0, 904461.311}, {128.0, 906596.492}, {129.0, 906222.747},
+			{130.0, 908522.211}, {131.0, 908546.716}, {132.0, 910963.332}, {133.0, 911396.379},
+			{134.0, 916554.718}, {135.0, 920101.182}, {136.0, 925599.357}, {137.0, 929472.454},
+			{138.0, 935367.193}, {139.0, 939262.917}, {107.0, 943478.321}, {108.0, 938086.025},
+			{109.0, 935089.033}, {110.0, 930269.239}, {111.0, 928004.55}, {112.0, 923650.064},
+			{0.0, 0.0}, {114.0, 918048.0}, {115.0, 916808.658}, {116.0, 913648.314},
+			{117.0, 913074.0}, {118.0, 910074.0}, {119.0, 910087.465}, {120.0, 907405.255},
+			{121.0, 907588.82}, {122.0, 905588.52}, {123.0, 906209.021}, {124.0, 904629.333},
+			{125.0, 905623.313}, {126.0, 904471.838}, {127.0, 905808.6}, {128.0, 904983.687},
+			{129.0, 906670.211}, {130.0, 906126.384}, {131.0, 907993.514}, {132.0, 907827.361},
+			{133.0, 909775.663}, {134.0, 910059.382}, {135.0, 914604.695}, {136.0, 918028.18},
+			{137.0, 922726.394}, {138.0, 926493.403}, {139.0, 931715.917}, {140.0, 935666.084},
+			{141.0, 941202.0}, {108.0, 950434.948}, {109.0, 944258.765}, {110.0, 941603.989},
+			{111.0, 935559.071}, {112.0, 933221.666}, {113.0, 927980.331}, {114.0, 926293.945},
+			{115.0, 921581.112}, {116.0, 920358.76}, {117.0, 916178.68}, {118.0, 915410.713},
+			{119.0, 911784.27}, {120.0, 911453.014}, {121.0, 908367.658}, {122.0, 908481.75},
+			{123.0, 905891.588}, {124.0, 906394.05}, {125.0, 904296.794}, {126.0, 905182.899},
+			{127.0, 903530.996}, {128.0, 904780.85892}, {129.0, 903509.349}, {130.0, 905084.136},
+			{131.0, 904155.08697}, {132.0, 905910.75}, {133.0, 905393.033}, {134.0, 907231.661},
+			{135.0, 907214.476}, {136.0, 911557.773}, {137.0, 914146.271}, {138.0, 918792.203},
+			{139.0, 921645.817}, {140.0, 926787.184}, {141.0, 929973.098}, {142.0, 935369.553},
+			{143.0, 938945.079}, {144.0, 944719.634}, {145.0, 948518.248}, {111.0, 950305.341},
+			{112.0, 944428.488}, {113.0, 941296.175}, {0.0, 0.0}, {0.0, 0.0},
+			{116.0, 928616.726}, {117.0, 926559.519}, {118.0, 922377.33}, {119.0, 920677.279},
+			{120.0, 917227.238}, {121.0, 916108.145}, {122.0, 912996.062}, {123.0, 912257.798},
+			{124.0, 909727.867}, {125.0, 909445.655}, {126.0, 907417.381}, {127.0, 907748.648},
+			{128.0, 906065.69}, {129.0, 906709.283}, {130.0, 905464.999}, {131.0, 906437.743},
+			{132.0, 905451.961}, {133.0, 906718.503}, {134.0, 905977.234}, {135.0, 907311.59},
+			{136.0, 907089.464}, {137.0, 911017.207}, {138.0, 913363.992}, {139.0, 917283.305},
+			{140.0, 920045.086}, {141.0, 924299.512}, {142.0, 927347.348}, {143.0, 932075.404},
+			{144.0, 935528.93}, {145.0, 940621.87}, {146.0, 944261.515}, {147.0, 949639.029},
+			{113.0, 950718.495}, {0.0, 0.0}, {0.0, 0.0}, {116.0, 938316.561},
+			{0.0, 0.0}, {118.0, 930659.686}, {119.0, 926045.0}, {120.0, 924052.289},
+			{121.0, 919904.0}, {122.0, 918781.062}, {123.0, 915093.629}, {124.0, 914471.843},
+			{125.0, 911250.204}, {126.0, 911091.275}, {127.0, 908342.408}, {128.0, 908680.896},
+			{129.0, 906320.874}, {130.0, 906941.181}, {131.0, 905061.098}, {132.0, 906007.325},
+			{133.0, 904508.399}, {134.0, 905688.606}, {135.0, 904575.959}, {136.0, 905827.375},
+			{137.0, 905247.229}, {138.0, 908841.334}, {139.0, 910606.666}, {140.0, 914403.5},
+			{141.0, 916432.888}, {142.0, 920625.15}, {143.0, 922954.821}, {144.0, 927518.4},
+			{145.0, 930276.431}, {146.0, 935303.9}, {147.0, 938170.578}, {148.0, 942973.0},
+			{123.0, 924574.275}, {124.0, 920815.932}, {125.0, 919512.667}, {126.0, 916375.084},
+			{127.0, 915592.123}, {128.0, 912694.475}, {129.0, 912369.413}, {130.0, 910070.0},
+			{131.0, 910118.959}, {132.0, 908218.0}, {133.0, 908514.011}, {134.0, 906984.568},
+			{135.0, 907634.962}, {136.0, 906450.618}, {137.0, 907117.834}, {138.0, 906358.804},
+			{139.0, 909483.184}, {140.0, 910969.222}, {141.0, 914090.454}, {142.0, 916079.422},
+			{143.0, 919645.589}, {144.0, 921808.066}, {145.0, 925871.468}, {146.0, 928417.8},
+			{147.0, 932679.4}, {148.0, 935351.26}, {149.0, 939742.0}, {150.0, 942769.0},
+			{125.0, 923971.0}, {126.0, 922727.0}, {127.0, 918911.0}, {128.0, 918102.0},
+			{129.0, 914736.0}, {130.0, 914429.465}, {131.0, 911463.846}, {132.0, 911520.402},
+			{133.0, 908928.142}, {134.0, 909160.799}, {135.0, 907129.438}, {136.0, 907762.596},
+			{137.0, 905988.743}, {138.0, 906657.625}, {139.0, 905446.424}, {140.0, 908283.987},
+			{141.0, 909249.884}, {142.0, 912391.63}, {143.0, 913652.83}, {144.0, 917265.144},
+			{145.0, 918802.065}, {146.0, 922689.903}, {147.0, 924424.196}, {148.0, 928426.9},
+			{149.0, 930384.035}, {150.0, 934272.2}, {127.0, 928791.0}, {128.0, 925095.0},
+			{129.0, 923590.0}, {130.0, 920234.96}, {131.0, 919240.0}, {132.0, 916330.561},
+			{133.0, 915696.729}, {134.0, 913111.774}, {135.0, 912677.532}, {136.0, 910679.304},
+			{137.0, 910752.059}, {138.0, 908943.27}, {139.0, 909083.592}, {140.0, 907658.403},
+			{141.0, 910050.44}, {142.0, 910822.564}, {143.0, 913310.75}, {144.0, 914518.033},
+			{145.0, 917679.549}, {146.0, 919007.458}, {147.0, 922130.015}, {148.0, 923736.1},
+			{149.0, 926676.415}, {150.0, 928309.114}, {151.0, 931552.9}, {152.0, 933903.532},
+			{153.0, 937621.738}, {154.0, 940509.259}, {129.0, 928506.0}, {130.0, 927248.02},
+			{131.0, 923321.237}, {132.0, 922348.0}, {133.0, 918790.21}, {134.0, 918181.32},
+			{135.0, 914976.064}, {136.0, 914562.448}, {137.0, 911949.717}, {138.0, 911954.407},
+			{139.0, 909544.332}, {140.0, 909615.488}, {141.0, 907728.895}, {142.0, 909819.887},
+			{143.0, 910092.865}, {144.0, 912579.199}, {145.0, 913122.503}, {146.0, 916106.01},
+			{147.0, 916899.093}, {148.0, 920154.648}, {149.0, 920901.525}, {150.0, 923839.565},
+			{151.0, 924691.509}, {152.0, 927717.949}, {153.0, 929333.977}, {154.0, 933135.668},
+			{155.0, 935078.868}, {156.0, 939386.037}, {132.0, 929782.0}, {133.0, 928353.0},
+			{134.0, 924796.0}, {135.0, 923595.949}, {136.0, 920479.522}, {137.0, 919548.077},
+			{138.0, 916799.806}, {139.0, 916034.122}, {140.0, 913555.084}, {141.0, 912890.428},
+			{142.0, 910938.073}, {143.0, 912596.224}, {144.0, 912755.773}, {145.0, 914702.286},
+			{146.0, 915144.638}, {147.0, 917481.255}, {148.0, 918341.658}, {149.0, 920990.217},
+			{150.0, 921216.817}, {151.0, 923505.481}, {152.0, 924156.436}, {153.0, 926449.364},
+			{154.0, 928137.024}, {155.0, 931117.49}, {156.0, 933121.37}, {157.0, 936565.121},
+			{158.0, 939286.479}, {134.0, 932520.0}, {135.0, 928275.555}, {136.0, 926970.517},
+			{137.0, 923243.99}, {138.0, 922296.634}, {139.0, 918994.717}, {140.0, 918481.591},
+			{141.0, 915204.532}, {142.0, 914634.821}, {143.0, 912006.373}, {144.0, 913417.244},
+			{145.0, 913046.881}, {146.0, 914904.064}, {147.0, 914829.012}, {148.0, 917191.375},
+			{149.0, 917282.195}, {150.0, 919939.066}, {151.0, 919739.04}, {152.0, 922103.969},
+			{153.0, 922216.164}, {154.0, 924647.051}, {155.0, 925538.511}, {156.0, 928418.673},
+			{157.0, 929950.979}, {158.0, 933217.202}, {159.0, 935335.286}, {160.0, 939160.143},
+			{136.0, 935430.722}, {137.0, 933709.0}, {138.0, 929792.31}, {139.0, 928087.637},
+			{140.0, 924931.745}, {141.0, 923441.836}, {142.0, 920298.681}, {143.0, 918819.517},
+			{144.0, 916272.668}, {145.0, 917210.909}, {146.0, 916752.276}, {147.0, 918089.294},
+			{148.0, 917937.086}, {149.0, 919707.229}, {150.0, 919856.86}, {151.0, 921751.235},
+			{152.0, 921237.043}, {153.0, 922985.955}, {154.0, 922900.102}, {155.0, 924763.285},
+			{156.0, 925432.791}, {157.0, 927798.581}, {158.0, 929099.612}, {159.0, 931850.916},
+			{160.0, 933664.066}, {161.0, 936979.303}, {162.0, 939360.977}, {139.0, 933674.0},
+			{140.0, 932126.0}, {141.0, 928116.0}, {142.0, 926750.682}, {143.0, 922963.0},
+			{144.0, 921710.37}, {145.0, 918318.548}, {146.0, 919100.987}, {147.0, 918121.503},
+			{148.0, 919347.831}, {149.0, 918664.066}, {150.0, 920355.109}, {151.0, 919798.822},
+			{152.0, 921757.359}, {153.0, 920873.398}, {154.0, 922629.796}, {155.0, 922130.562},
+			{156.0, 923967.87}, {157.0, 924111.646}, {158.0, 926396.267}, {159.0, 927061.537},
+			{160.0, 929676.602}, {161.0, 930992.146}, {162.0, 934176.832}, {139.0, 945805.049},
+			{140.0, 941448.0}, {141.0, 939280.859}, {142.0, 935137.335}, {143.0, 933045.0},
+			{144.0, 928729.105}, {145.0, 927252.768}, {146.0, 924054.62}, {147.0, 924275.323},
+			{148.0, 923253.753}, {149.0, 923664.864}, {150.0, 923109.001}, {151.0, 924082.263},
+			{152.0, 923441.978}, {153.0, 924684.106}, {154.0, 923509.921}, {155.0, 924754.43},
+			{156.0, 924032.328}, {157.0, 925420.166}, {158.0, 925353.933}, {159.0, 927174.778},
+			{160.0, 927577.001}, {161.0, 929493.955}, {162.0, 930653.261}, {163.0, 933356.559},
+			{0.0, 0.0}, {165.0, 937858.119}, {142.0, 943994.335}, {143.0, 939269.514},
+			{144.0, 937473.994}, {145.0, 932844.529}, {146.0, 931082.715}, {147.0, 927149.772},
+			{148.0, 927325.448}, {149.0, 925593.08}, {150.0, 926191.253}, {151.0, 924725.363},
+			{152.0, 925771.992}, {153.0, 924429.028}, {154.0, 925758.459}, {155.0, 924284.038},
+			{156.0, 925469.667}, {157.0, 924414.597}, {158.0, 925746.023}, {159.0, 925203.244},
+			{160.0, 926939.088}, {161.0, 926804.168}, {162.0, 928736.879}, {163.0, 929180.472},
+			{164.0, 931709.054}, {165.0, 932812.461}, {166.0, 935661.823}, {167.0, 937133.716},
+			{168.0, 940313.971}, {143.0, 952109.714}, {144.0, 947267.394}, {145.0, 944993.506},
+			{146.0, 940142.295}, {147.0, 937743.928}, {148.0, 933819.672}, {149.0, 933498.358},
+			{150.0, 931698.177}, {151.0, 931717.465}, {152.0, 930206.632}, {153.0, 930606.841},
+			{154.0, 929103.634}, {155.0, 929705.436}, {156.0, 928251.999}, {157.0, 928944.692},
+			{158.0, 927718.768}, {159.0, 928735.204}, {160.0, 927860.759}, {161.0, 929101.485},
+			{162.0, 928739.921}, {163.0, 930239.483}, {164.0, 930328.047}, {165.0, 932290.139},
+			{166.0, 933138.994}, {167.0, 935521.676}, {168.0, 936878.63}, {169.0, 939625.289},
+			{170.0, 941471.49}, {145.0, 952418.359}, {146.0, 949964.458}, {147.0, 944735.029},
+			{148.0, 942306.0}, {149.0, 937915.528}, {150.0, 937448.567}, {151.0, 935050.169},
+			{152.0, 935084.279}, {153.0, 932790.743}, {154.0, 933215.684}, {155.0, 931065.89},
+			{156.0, 931922.655}, {157.0, 929893.474}, {158.0, 930690.875}, {159.0, 929077.13},
+			{160.0, 930003.191}, {161.0, 928786.96}, {162.0, 930039.567}, {163.0, 929207.392},
+			{164.0, 930733.198}, {165.0, 930299.023}, {166.0, 932054.119}, {167.0, 932376.192},
+			{168.0, 934596.353}, {169.0, 935470.673}, {170.0, 938036.148}, {171.0, 939362.344},
+			{146.0, 961379.89}, {147.0, 958384.029}, {0.0, 0.0}, {0.0, 0.0},
+			{150.0, 945493.201}, {151.0, 944476.0}, {152.0, 942057.244}, {153.0, 941570.067},
+			{154.0, 939209.578}, {155.0, 938985.597}, {156.0, 936973.0}, {157.0, 936979.525},
+			{158.0, 934975.0}, {159.0, 935263.106}, {160.0, 933549.0}, {161.0, 934000.872},
+			{162.0, 932657.941}, {163.0, 933543.281}, {164.0, 932442.269}, {165.0, 933560.092},
+			{166.0, 932856.635}, {167.0, 934177.868}, {168.0, 934218.35}, {169.0, 935806.507},
+			{170.0, 936435.126}, {171.0, 938406.067}, {172.0, 939606.632}, {173.0, 942174.064},
+			{174.0, 943842.313}, {175.0, 946997.711}, {150.0, 955402.458}, {151.0, 950326.7},
+			{0.0, 0.0}, {153.0, 946395.701}, {154.0, 945783.217}, {155.0, 942816.893},
+			{156.0, 942649.23}, {157.0, 939870.534}, {158.0, 940054.787}, {159.0, 937559.763},
+			{160.0, 937906.846}, {161.0, 935773.771}, {162.0, 936339.8}, {163.0, 934495.103},
+			{164.0, 935270.241}, {165.0, 933874.249}, {166.0, 934953.337}, {167.0, 933889.106},
+			{168.0, 935182.016}, {169.0, 934767.245}, {170.0, 936331.517}, {171.0, 936386.658},
+			{172.0, 938216.215}, {173.0, 938867.548}, {174.0, 941281.91}, {175.0, 942574.708},
+			{176.0, 945263.848}, {177.0, 946649.71}, {152.0, 958805.054}, {0.0, 0.0},
+			{154.0, 954326.011}, {155.0, 953086.606}, {156.0, 950144.045}, {157.0, 949315.626},
+			{158.0, 946635.615}, {159.0, 946033.0}, {160.0, 943572.0}, {161.0, 943282.776},
+			{162.0, 941179.0}, {163.0, 941339.0}, {164.0, 939406.758}, {165.0, 939859.0},
+			{166.0, 938270.0}, {167.0, 938735.139}, {168.0, 937643.653}, {169.0, 938479.234},
+			{170.0, 937918.66}, {171.0, 939091.417}, {172.0, 938935.822}, {173.0, 940342.938},
+			{174.0, 940777.308}, {175.0, 942691.809}, {176.0, 943763.668}, {177.0, 945960.162},
+			{178.0, 947333.082}, {179.0, 949890.876}, {180.0, 951908.0}, {0.0, 0.0},
+			{182.0, 957363.0}, {155.0, 959401.889}, {0.0, 0.0}, {157.0, 954801.222},
+			{158.0, 953995.838}, {159.0, 950682.513}, {160.0, 950279.151}, {161.0, 947214.896},
+			{162.0, 947113.258}, {163.0, 944370.544}, {164.0, 944567.0}, {165.0, 942180.0},
+			{166.0, 942600.0}, {167.0, 940568.0}, {168.0, 941259.0}, {169.0, 939609.0},
+			{170.0, 940492.0}, {171.0, 939449.716}, {172.0, 940513.0}, {173.0, 940048.48},
+			{174.0, 941511.527}, {175.0, 941409.905}, {176.0, 943230.32}, {177.0, 943708.456},
+			{178.0, 945825.838}, {179.0, 946559.669}, {180.0, 949110.965}, {181.0, 950563.816},
+			{182.0, 953534.004}, {183.0, 955448.587}, {184.0, 958862.0}, {185.0, 960897.0},
+			{156.0, 968230.251}, {0.0, 0.0}, {158.0, 963028.052}, {159.0, 961541.679},
+			{160.0, 958369.031}, {161.0, 957294.202}, {162.0, 954337.195}, {163.0, 953534.0},
+			{164.0, 950780.303}, {165.0, 950512.0}, {166.0, 948093.0}, {167.0, 948047.0},
+			{168.0, 946011.0}, {169.0, 946175.0}, {170.0, 944476.0}, {171.0, 944895.0},
+			{172.0, 943750.0}, {173.0, 944454.0}, {174.0, 943737.0}, {175.0, 944857.0},
+			{176.0, 944482.073}, {0.0, 0.0}, {178.0, 945939.187}, {179.0, 947468.392},
+			{180.0, 947999.331}, {181.0, 950155.413}, {182.0, 951376.18}, {183.0, 954010.038},
+			{184.0, 955561.396}, {185.0, 958553.111}, {186.0, 960391.0}, {187.0, 963916.0},
+			{159.0, 968516.753}, {0.0, 0.0}, {161.0, 963500.347}, {162.0, 962524.511},
+			{163.0, 958952.222}, {164.0, 958280.974}, {165.0, 955031.346}, {166.0, 954805.873},
+			{167.0, 951805.262}, {168.0, 951778.677}, {169.0, 949231.2}, {170.0, 949451.0},
+			{171.0, 947292.0}, {172.0, 947689.0}, {173.0, 946079.0}, {174.0, 946717.0},
+			{175.0, 945634.0}, {176.0, 946643.0}, {177.0, 945885.925}, {178.0, 947079.501},
+			{179.0, 946713.435}, {180.0, 948218.863}, {181.0, 948205.721}, {182.0, 950224.5},
+			{183.0, 950933.26}, {184.0, 953421.286}, {185.0, 954365.215}, {186.0, 957161.323},
+			{187.0, 958488.395}, {188.0, 961763.0}, {189.0, 963089.066}, {190.0, 966531.0},
+			{160.0, 977627.121}, {0.0, 0.0}, {162.0, 972085.441}, {163.0, 970507.124},
+			{164.0, 967085.375}, {165.0, 965760.94}, {0.0, 0.0}, {167.0, 961572.608},
+			{168.0, 958765.991}, {169.0, 958224.966}, {170.0, 955716.0}, {171.0, 955408.079},
+			{172.0, 953243.0}, {173.0, 953115.0}, {174.0, 951381.0}, {175.0, 951623.0},
+			{176.0, 950328.0}, {177.0, 950989.0}, {178.0, 949989.715}, {179.0, 950791.568},
+			{180.0, 950061.523}, {181.0, 951211.645}, {182.0, 950821.39}, {183.0, 952528.267},
+			{184.0, 952958.337}, {185.0, 954989.419}, {186.0, 955752.288}, {187.0, 958113.728},
+			{188.0, 959227.817}, {189.0, 961743.36}, {190.0, 963123.437}, {191.0, 966088.0},
+			{192.0, 967545.0}, {163.0, 978075.966}, {0.0, 0.0}, {165.0, 972698.141},
+			{166.0, 971548.938}, {167.0, 967798.812}, {168.0, 967017.833}, {169.0, 963578.673},
+			{170.0, 963175.348}, {171.0, 960017.088}, {172.0, 959808.375}, {173.0, 957063.152},
+			{174.0, 956945.105}, {175.0, 954806.0}, {176.0, 954957.882}, {177.0, 953253.3},
+			{178.0, 953816.669}, {179.0, 952379.93}, {180.0, 953247.188}, {181.0, 952110.153},
+			{182.0, 953124.719}, {183.0, 952492.949}, {184.0, 954045.995}, {185.0, 953837.66},
+			{186.0, 955749.64}, {187.0, 955837.361}, {188.0, 958146.005}, {189.0, 958445.496},
+			{190.0, 960928.159}, {191.0, 961478.881}, {192.0, 964149.753}, {193.0, 965179.477},
+			{194.0, 968318.0}, {195.0, 969643.277}, {166.0, 981671.981}, {167.0, 979960.981},
+			{168.0, 976281.287}, {0.0, 0.0}, {170.0, 971645.522}, {171.0, 970607.036},
+			{172.0, 967505.496}, {173.0, 966866.676}, {174.0, 964149.521}, {175.0, 963630.119},
+			{176.0, 961301.5}, {177.0, 961082.0}, {178.0, 959117.596}, {179.0, 959229.446},
+			{180.0, 957634.694}, {181.0, 958076.296}, {182.0, 956839.968}, {183.0, 957476.0},
+			{184.0, 956698.0}, {185.0, 957946.754}, {186.0, 957542.0}, {187.0, 958835.046},
+			{188.0, 958722.669}, {189.0, 960543.445}, {190.0, 960591.527}, {191.0, 962602.485},
+			{192.0, 962923.824}, {193.0, 965075.773}, {194.0, 965976.967}, {195.0, 968399.696},
+			{196.0, 969657.233}, {0.0, 0.0}, {198.0, 973807.115}, {167.0, 988183.004},
+			{0.0, 0.0}, {169.0, 982502.095}, {170.0, 981245.502}, {171.0, 977340.788},
+			{172.0, 976443.315}, {173.0, 972819.832}, {174.0, 972395.457}, {175.0, 968938.214},
+			{176.0, 968469.529}, {177.0, 965649.248}, {178.0, 965358.719}, {179.0, 963031.563},
+			{180.0, 963089.927}, {181.0, 961171.571}, {182.0, 961596.653}, {183.0, 959920.039},
+			{184.0, 960613.659}, {185.0, 959350.846}, {186.0, 960616.976}, {187.0, 959397.56},
+			{188.0, 960848.542}, {189.0, 959949.876}, {190.0, 961676.363}, {191.0, 961042.736},
+			{192.0, 962984.616}, {193.0, 962683.527}, {194.0, 964794.353}, {195.0, 964954.675},
+			{196.0, 967343.053}, {197.0, 967896.734}, {198.0, 970597.038}, {199.0, 971444.625},
+			{200.0, 974513.293}, {201.0, 975639.0}, {170.0, 991881.542}, {171.0, 989996.708},
+			{172.0, 986223.808}, {0.0, 0.0}, {174.0, 981316.085}, {175.0, 980116.927},
+			{176.0, 976870.379}, {177.0, 976055.945}, {178.0, 973173.668}, {179.0, 972489.883},
+			{180.0, 970079.103}, {181.0, 969617.874}, {182.0, 967588.108}, {183.0, 967451.524},
+			{184.0, 965798.874}, {185.0, 965952.703}, {186.0, 964543.155}, {187.0, 965247.969},
+			{188.0, 963948.286}, {189.0, 964751.75}, {190.0, 963716.455}, {191.0, 964817.684},
+			{192.0, 964138.447}, {193.0, 965419.062}, {194.0, 965037.851}, {195.0, 966571.221},
+			{196.0, 966570.114}, {197.0, 968243.724}, {198.0, 968766.582}, {199.0, 970756.556},
+			{200.0, 971657.665}, {201.0, 973856.0}, {202.0, 975154.498}, {171.0, 998863.391},
+			{0.0, 0.0}, {173.0, 992870.583}, {174.0, 991441.086}, {175.0, 987348.335},
+			{176.0, 986277.376}, {177.0, 982484.158}, {178.0, 981826.899}, {179.0, 978260.249},
+			{180.0, 977819.357}, {181.0, 974689.132}, {182.0, 974444.629}, {183.0, 971713.221},
+			{184.0, 971890.676}, {185.0, 969362.017}, {186.0, 969814.158}, {187.0, 967576.91},
+			{188.0, 968194.748}, {189.0, 966322.169}, {190.0, 967158.247}, {191.0, 965634.182},
+			{192.0, 966653.377}, {193.0, 965449.111}, {194.0, 966705.751}, {195.0, 965833.444},
+			{196.0, 967213.713}, {197.0, 966769.179}, {198.0, 968280.989}, {199.0, 968326.934},
+			{200.0, 970303.038}, {201.0, 970643.585}, {202.0, 972872.326}, {203.0, 973494.037},
+			{204.0, 976073.125}, {205.0, 977513.756}, {206.0, 982300.0}, {207.0, 985759.0},
+			{176.0, 624.367}, {176.0, 996413.797}, {0.0, 0.0}, {178.0, 991123.405},
+			{179.0, 989923.019}, {180.0, 986259.992}, {181.0, 985691.88}, {182.0, 982192.846},
+			{183.0, 981875.093}, {184.0, 978789.191}, {185.0, 978650.841}, {186.0, 975904.743},
+			{187.0, 976020.886}, {188.0, 973573.527}, {189.0, 973835.551}, {190.0, 971784.096},
+			{191.0, 972225.0}, {192.0, 970501.997}, {193.0, 971081.411}, {194.0, 969774.096},
+			{195.0, 970481.192}, {196.0, 969573.986}, {197.0, 970446.673}, {198.0, 969877.0},
+			{199.0, 970963.602}, {200.0, 970820.168}, {201.0, 972109.089}, {202.0, 972344.022},
+			{203.0, 973863.337}, {204.0, 974427.237}, {205.0, 976110.026}, {206.0, 977418.586},
+			{207.0, 982017.992}, {208.0, 985351.75}, {209.0, 990072.97}, {210.0, 993475.0},
+			{0.0, 0.0}, {213.0, 1915.0}, {178.0, 3837.163}, {179.0, 2201.452},
+			{179.0, 997915.842}, {180.0, 996653.386}, {181.0, 992672.94}, {182.0, 991867.668},
+			{183.0, 988135.702}, {184.0, 987609.989}, {185.0, 984238.196}, {186.0, 983910.836},
+			{187.0, 980874.592}, {188.0, 980843.639}, {189.0, 978081.828}, {190.0, 978281.0},
+			{191.0, 975785.115}, {192.0, 976173.234}, {193.0, 974011.706}, {194.0, 974548.743},
+			{195.0, 972787.466}, {196.0, 973434.717}, {197.0, 972015.397}, {198.0, 972912.542},
+			{199.0, 971818.332}, {200.0, 972870.425}, {201.0, 972151.604}, {202.0, 973390.535},
+			{203.0, 973043.42}, {204.0, 974481.597}, {205.0, 974465.124}, {206.0, 975896.735},
+			{207.0, 976651.918}, {208.0, 981089.898}, {209.0, 984188.301}, {210.0, 988735.356},
+			{211.0, 991895.975}, {212.0, 996560.867}, {213.0, 999803.788}, {215.0, 4661.59},
+			{184.0, 1141.25}, {0.0, 0.0}, {185.0, 996622.402}, {186.0, 993147.276},
+			{187.0, 992276.184}, {188.0, 989195.141}, {189.0, 988620.883}, {190.0, 985786.975},
+			{191.0, 985470.078}, {192.0, 982947.223}, {193.0, 982792.362}, {194.0, 980648.762},
+			{195.0, 980666.509}, {196.0, 978864.929}, {197.0, 979206.0}, {198.0, 977672.893},
+			{199.0, 978131.093}, {200.0, 977008.512}, {201.0, 977733.1}, {202.0, 976892.145},
+			{203.0, 977835.717}, {204.0, 977386.323}, {205.0, 978498.757}, {206.0, 978470.471},
+			{207.0, 979741.981}, {208.0, 980398.519}, {209.0, 984120.156}, {210.0, 987268.698},
+			{211.0, 991285.016}, {212.0, 994383.608}, {213.0, 998710.938}, {215.0, 1749.149},
+			{216.0, 6305.989}, {217.0, 9372.0}, {218.0, 14188.0}, {186.0, 4402.577},
+			{187.0, 3036.624}, {187.0, 999415.655}, {188.0, 998473.415}, {189.0, 995100.519},
+			{190.0, 994558.488}, {191.0, 991335.788}, {192.0, 991062.403}, {193.0, 988186.015},
+			{194.0, 988130.617}, {195.0, 985536.094}, {196.0, 985659.607}, {197.0, 983388.672},
+			{198.0, 983673.021}, {199.0, 981812.27}, {200.0, 982263.777}, {201.0, 980738.881},
+			{202.0, 981415.995}, {203.0, 980309.863}, {204.0, 981190.004}, {205.0, 980473.654},
+			{206.0, 981593.252}, {207.0, 981245.616}, {208.0, 982430.276}, {209.0, 982873.601},
+			{210.0, 986653.085}, {211.0, 988867.896}, {212.0, 992857.083}, {213.0, 995201.208},
+			{214.0, 999418.454}, {216.0, 1913.506}, {217.0, 6316.216}, {218.0, 8971.502},
+			{219.0, 13614.0}, {220.0, 16386.0}, {221.0, 21228.0}, {222.0, 24140.0},
+			{191.0, 4148.086}, {192.0, 3141.034}, {192.0, 999927.728}, {193.0, 999226.872},
+			{194.0, 996274.485}, {195.0, 995797.421}, {196.0, 993177.357}, {197.0, 992791.673},
+			{198.0, 990527.719}, {199.0, 990351.1}, {200.0, 988417.061}, {201.0, 988630.38},
+			{202.0, 986942.957}, {203.0, 987251.197}, {204.0, 986074.041}, {205.0, 986656.148},
+			{206.0, 985799.783}, {207.0, 986613.042}, {208.0, 986169.944}, {209.0, 987147.338},
+			{210.0, 987496.147}, {211.0, 990737.223}, {212.0, 992936.514}, {213.0, 996371.601},
+			{214.0, 998651.89}, {216.0, 2422.631}, {217.0, 4717.835}, {218.0, 8693.735},
+			{219.0, 11160.647}, {220.0, 15433.0}, {221.0, 18017.0}, {222.0, 22494.0},
+			{223.0, 25151.0}, {224.0, 29749.0}, {193.0, 9707.964}, {194.0, 6144.424},
+			{195.0, 5421.699}, {196.0, 2115.945}, {197.0, 1621.43}, {197.0, 998679.156},
+			{198.0, 998390.273}, {199.0, 995700.707}, {200.0, 995628.179}, {201.0, 993263.902},
+			{202.0, 993393.732}, {203.0, 991443.644}, {204.0, 991723.204}, {205.0, 990195.358},
+			{206.0, 990730.2}, {207.0, 989634.295}, {208.0, 990401.388}, {209.0, 989688.854},
+			{210.0, 990600.686}, {211.0, 990703.528}, {212.0, 993885.064}, {213.0, 995362.566},
+			{214.0, 998745.498}, {216.0, 271.464}, {217.0, 3927.562}, {218.0, 5601.052},
+			{219.0, 9478.753}, {220.0, 11392.534}, {221.0, 15535.709}, {222.0, 17576.286},
+			{223.0, 21889.285}, {224.0, 24095.804}, {225.0, 28485.574}, {226.0, 30861.382},
+			{227.0, 35304.396}, {228.0, 37835.418}, {229.0, 42257.276}, {197.0, 11008.09},
+			{198.0, 10278.138}, {199.0, 7269.389}, {200.0, 6583.507}, {201.0, 3852.496},
+			{202.0, 3323.946}, {203.0, 940.872}, {204.0, 651.974}, {204.0, 998593.858},
+			{205.0, 998666.211}, {206.0, 996946.474}, {207.0, 997138.018}, {208.0, 995953.197},
+			{209.0, 996421.657}, {210.0, 995555.259}, {211.0, 996225.453}, {212.0, 996185.861},
+			{213.0, 998970.785}, {215.0, 341.456}, {216.0, 3189.445}, {217.0, 4631.902},
+			{218.0, 7578.274}, {219.0, 9251.553}, {220.0, 12326.778}, {221.0, 14253.757},
+			{222.0, 17582.62}, {223.0, 19734.313}, {224.0, 23348.1}, {225.0, 25572.478},
+			{226.0, 29544.515}, {227.0, 31865.417}, {228.0, 35839.437}, {229.0, 38291.455},
+			{230.0, 42390.791}, {231.0, 45175.357}, {232.0, 49461.224}, {233.0, 52517.838},
+			{201.0, 12814.683}, {202.0, 9742.264}, {203.0, 9298.745}, {204.0, 6502.228},
+			{205.0, 6268.415}, {206.0, 3827.763}, {207.0, 3805.161}, {208.0, 1854.929},
+			{209.0, 1994.879}, {210.0, 475.356}, {211.0, 893.213}, {211.0, 999786.399},
+			{213.0, 370.97}, {214.0, 99.554}, {215.0, 2720.08}, {216.0, 3533.117},
+			{217.0, 6322.806}, {218.0, 7140.325}, {219.0, 10085.176}, {220.0, 11025.562},
+			{221.0, 13917.224}, {222.0, 15373.355}, {223.0, 18500.719}, {224.0, 20210.453},
+			{225.0, 23610.574}, {226.0, 25408.455}, {227.0, 29176.474}, {228.0, 31068.657},
+			{229.0, 34956.707}, {230.0, 37054.78}, {231.0, 41027.086}, {232.0, 43475.27},
+			{233.0, 47594.573}, {234.0, 50382.104}, {205.0, 15144.158}, {206.0, 14470.787},
+			{207.0, 11965.973}, {208.0, 11544.073}, {209.0, 9494.22}, {210.0, 9436.13},
+			{211.0, 7731.894}, {212.0, 7812.501}, {213.0, 6607.333}, {214.0, 6917.762},
+			{215.0, 6474.132}, {216.0, 8743.367}, {217.0, 9343.777}, {218.0, 11641.093},
+			{219.0, 12420.348}, {220.0, 14754.45}, {221.0, 15591.199}, {222.0, 17843.887},
+			{223.0, 19136.872}, {224.0, 21722.239}, {225.0, 23228.647}, {226.0, 26097.069},
+			{227.0, 27750.666}, {228.0, 31019.767}, {229.0, 32947.0}, {230.0, 36327.0},
+			{231.0, 38393.0}, {232.0, 42034.0}, {233.0, 44346.0}, {234.0, 48139.0},
+			{235.0, 50840.0}, {236.0, 54988.0}, {208.0, 17910.722}, {0.0, 0.0},
+			{210.0, 15093.437}, {211.0, 14933.183}, {212.0, 13001.487}, {213.0, 13011.447},
+			{214.0, 11481.431}, {215.0, 11724.805}, {216.0, 11055.714}, {217.0, 13103.444},
+			{218.0, 13276.242}, {219.0, 15535.677}, {220.0, 15747.926}, {221.0, 18186.236},
+			{222.0, 18468.3}, {223.0, 20811.546}, {224.0, 21464.157}, {225.0, 23950.907},
+			{226.0, 24903.686}, {227.0, 27702.618}, {228.0, 28739.835}, {229.0, 31761.431},
+			{230.0, 33132.358}, {231.0, 36302.853}, {232.0, 38053.689}, {233.0, 41580.208},
+			{234.0, 43599.86}, {235.0, 47255.0}, {236.0, 49657.0}, {237.0, 53629.0},
+			{212.0, 23181.425}, {213.0, 21108.697}, {214.0, 20918.561}, {215.0, 19177.728},
+			{216.0, 19108.242}, {217.0, 18323.692}, {218.0, 20057.853}, {219.0, 19903.65},
+			{0.0, 0.0}, {221.0, 21874.846}, {0.0, 0.0}, {223.0, 23962.232},
+			{224.0, 25617.21}, {225.0, 26130.844}, {226.0, 27947.872}, {227.0, 28804.477},
+			{228.0, 31050.748}, {229.0, 32095.652}, {230.0, 34539.789}, {231.0, 35882.575},
+			{232.0, 38590.3}, {233.0, 40246.605}, {234.0, 43305.615}, {235.0, 45399.0},
+			{236.0, 48668.0}, {237.0, 51023.0}, {238.0, 54637.0}, {215.0, 26756.035},
+			{216.0, 24762.747}, {0.0, 0.0}, {218.0, 23504.829}, {219.0, 24999.161},
+			{0.0, 0.0}, {221.0, 26323.299}, {222.0, 26057.953}, {223.0, 27737.168},
+			{224.0, 27613.974}, {225.0, 29393.555}, {226.0, 29338.749}, {227.0, 31181.587},
+			{228.0, 31371.351}, {229.0, 33505.909}, {230.0, 33940.102}, {231.0, 36292.252},
+			{232.0, 37154.86}, {233.0, 39634.367}, {234.0, 40950.37}, {235.0, 43928.19},
+			{236.0, 45566.201}, {237.0, 48728.38}, {238.0, 50786.996}, {239.0, 54292.048},
+			{240.0, 56592.425}, {219.0, 31623.021}, {0.0, 0.0}, {0.0, 0.0},
+			{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {225.0, 33910.797},
+			{0.0, 0.0}, {227.0, 34956.832}, {228.0, 36066.462}, {229.0, 36263.974},
+			{230.0, 37827.716}, {231.0, 38244.49}, {0.0, 0.0}, {233.0, 40739.489},
+			{234.0, 42893.32}, {235.0, 44061.591}, {236.0, 46568.392}, {237.0, 48171.71},
+			{238.0, 50944.671}, {239.0, 52937.599}, {240.0, 56163.83}, {241.0, 58250.697},
+			{242.0, 61639.615}, {228.0, 38741.387}, {229.0, 40145.819}, {230.0, 39650.703},
+			{231.0, 41126.41}, {232.0, 41184.526}, {233.0, 42997.345}, {234.0, 43317.478},
+			{235.0, 45284.682}, {236.0, 46056.756}, {237.0, 48407.957}, {238.0, 49558.25},
+			{239.0, 52161.669}, {240.0, 53811.812}, {241.0, 56849.722}, {242.0, 58741.045},
+			{243.0, 62002.119}, {244.0, 64204.415}, {245.0, 67824.568}, {246.0, 70204.209},
+			{229.0, 45249.909}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0},
+			{0.0, 0.0}, {0.0, 0.0}, {235.0, 47907.371}, {0.0, 0.0},
+			{0.0, 0.0}, {238.0, 51982.607}, {239.0, 53022.803}, {240.0, 55298.444},
+			{241.0, 56827.413}, {242.0, 59547.428}, {243.0, 61379.94}, {244.0, 64282.964},
+			{245.0, 66452.89}, {233.0, 50772.206}, {234.0, 50160.959}, {0.0, 0.0},
+			{236.0, 51374.506}, {237.0, 52868.923}, {238.0, 53081.595}, {239.0, 54908.593},
+			{240.0, 55528.329}, {241.0, 57651.288}, {242.0, 58834.263}, {243.0, 61387.403},
+			{244.0, 62750.694}, {245.0, 65491.113}, {246.0, 67222.082}, {247.0, 70352.726},
+			{248.0, 72349.101}, {249.0, 75954.006}, {250.0, 78357.556}, {251.0, 82285.036},
+			{243.0, 63005.98}, {244.0, 65179.039}, {245.0, 66359.885}, {246.0, 68671.367},
+			{247.0, 70305.94}, {0.0, 0.0}, {249.0, 74983.182}, {250.0, 78315.027},
+			{251.0, 80760.603}, {237.0, 62199.993}, {0.0, 0.0}, {0.0, 0.0},
+			{240.0, 62255.842}, {0.0, 0.0}, {242.0, 63754.533}, {0.0, 0.0},
+			{244.0, 65999.543}, {245.0, 68046.825}, {246.0, 68803.762}, {247.0, 70965.462},
+			{248.0, 72182.978}, {249.0, 74850.491}, {250.0, 76404.561}, {251.0, 79587.219},
+			{252.0, 81626.523}, {253.0, 85133.738}, {254.0, 87323.59}, {247.0, 73621.932},
+			{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, {251.0, 79992.224},
+			{252.0, 82979.189}, {253.0, 84821.305}, {254.0, 88020.527}, {255.0, 90273.553},
+			{246.0, 75350.815}, {0.0, 0.0}, {248.0, 77185.528}, {249.0, 78926.098},
+			{250.0, 79519.828}, {251.0, 81539.889}, {252.0, 82464.972}, {253.0, 85181.16},
+			{254.0, 86852.726}, {255.0, 89962.633}, {256.0, 91773.878}, {257.0, 95105.317},
+			{251.0, 84774.291}, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0},
+			{255.0, 91082.787}, {0.0, 0.0}, {257.0, 95537.977}, {258.0, 98429.825},
+			{252.0, 88966.141}, {253.0, 90562.831}, {254.0, 90954.259}, {255.0, 93191.404},
+			{256.0, 94280.866}, {257.0, 96884.419}, {0.0, 0.0}, {259.0, 100997.503},
+			{255.0, 96562.404}, {256.0, 98494.029}, {256.0, 101151.535}, {257.0, 102916.848},
+			{258.0, 103426.362}, {0.0, 0.0}, {0.0, 0.0}, {261.0, 108769.99},
+			{259.0, 109491.865}, {260.0, 114383.508}, {261.0, 115948.188}, {262.0, 116335.446},
+			{264.0, 128356.405}, {265.0, 129791.799}, {266.0, 130045.252}, {269.0, 144751.021},
+			{270.0, 144583.09}
+		};
+
+	}
+
+}
+
+#endif
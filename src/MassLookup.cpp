@@ -15,59 +15,56 @@ namespace SabreRecon {
 
 	MassLookup* MassLookup::s_instance = new MassLookup();
 	
-	MassLookup::MassLookup()
+	MassLookup::MassLookup() :
+		m_masses(MassData::nIsotopes, 0.0), m_symbols(MassData::nIsotopes)
 	{
-		std::ifstream massfile("etc/mass.txt");
-		if(massfile.is_open())
+		int index;
+		for(int Z=0; Z<=MassData::maxZ; Z++)
 		{
-			std::string junk, A, element;
-			int Z;
-			double atomicMassBig, atomicMassSmall, isotopicMass;
-			getline(massfile,junk);
-			getline(massfile,junk);
-			while(massfile>>junk)
+			for(int A=MassData::minA[Z]; A<MassData::minA[Z]+MassData::nA[Z]; A++)
 			{
-				massfile>>Z>>A>>element>>atomicMassBig>>atomicMassSmall;
-				isotopicMass = (atomicMassBig + atomicMassSmall*1e-6 - Z*electron_mass)*u_to_mev;
-				std::string key = "("+std::to_string(Z)+","+A+")";
-				massTable[key] = isotopicMass;
-				elementTable[Z] = element;
+				index = GetIndex(Z, A);
+				if(index == -1)
+					continue;
+				m_masses[index] = GetNuclearMass(Z, A);
+				m_symbols[index] = std::to_string(A) + MassData::symbols[Z];
 			}
 		}
-		else
-		{
-			std::cerr<<"ERR -- Unable to open mass file, check etc directory"<<std::endl;
-		}
 	}
 	
 	MassLookup::~MassLookup() {}
-	
-	//Returns nuclear mass in MeV
-	double MassLookup::FindMass(int Z, int A)
+
+	double MassLookup::MassNotFound(int Z, int A) const
 	{
-		std::string key = "("+std::to_string(Z)+","+std::to_string(A)+")";
-		auto data = massTable.find(key);
-		if(data == massTable.end())
-		{
-			std::cerr<<"WARN -- Unable to find mass of (Z,A)=("<<Z<<","<<A<<")."<<std::endl;
-			return 0.0;
-		}
-	
-		return data->second;
+		std::cerr<<"WARN -- Unable to find mass of (Z,A)=("<<Z<<","<<A<<")."<<std::endl;
+		return 0.0;
 	}
 	
 	//returns element symbol
-	std::string MassLookup::FindSymbol(int Z, int A)
+	const std::string& MassLookup::FindSymbol(int Z, int A) const
 	{
-		auto data = elementTable.find(Z);
-		if(data == elementTable.end())
+		static const std::string notFound = "";
+		int index = GetIndex(Z, A);
+		if(index == -1)
 		{
 			std::cerr<<"WARN -- Unable to find symbol of (Z,A)=("<<Z<<","<<A<<")."<<std::endl;
-			return "";
+			return notFound;
 		}
 	
-		std::string fullsymbol = std::to_string(A) + data->second;
-		return fullsymbol;
+		return m_symbols[index];
+	}
+
+	//returns Z of an element symbol
+	int MassLookup::FindZ(const std::string& element) const
+	{
+		if(element.empty())
+			return -1;
+		for(int Z=0; Z<=MassData::maxZ; Z++)
+		{
+			if(element == MassData::symbols[Z])
+				return Z;
+		}
+		return -1;
 	}
 
-}
\ No newline at end of file
+}
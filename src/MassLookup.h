@@ -8,13 +8,16 @@ of this map (MASS) for use throughout code it is included into.
 Written by G.W. McCann Aug. 2020
 
 Converted to true singleton to simplify usage -- Aug. 2021 GWM
+
+AME data is now compiled in (MassData.h) and indexed densely by Z and A, so lookups are an index calculation and a
+single load, and nothing is read from disk at startup.
 */
 #ifndef MASS_LOOKUP_H
 #define MASS_LOOKUP_H
 
-#include <fstream>
+#include "MassData.h"
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace SabreRecon {
 
@@ -23,16 +26,42 @@ namespace SabreRecon {
 	public:
 		MassLookup();
 		~MassLookup();
-		double FindMass(int Z, int A);
-		double FindMassU(int Z, int A) { return FindMass(Z, A)/u_to_mev; }
-		std::string FindSymbol(int Z, int A);
+		//Returns nuclear mass in MeV
+		inline double FindMass(int Z, int A) const
+		{
+			int index = GetIndex(Z, A);
+			return index == -1 ? MassNotFound(Z, A) : m_masses[index];
+		}
+		double FindMassU(int Z, int A) const { return FindMass(Z, A)/u_to_mev; }
+		const std::string& FindSymbol(int Z, int A) const;
+		int FindZ(const std::string& element) const; //-1 if the element symbol is unknown
 	
 		inline static MassLookup& GetInstance() { return *s_instance; }
+
+		//Index of (Z,A) in the MassData arrays, -1 if the isotope is not in the table
+		static constexpr int GetIndex(int Z, int A)
+		{
+			if(Z < 0 || Z > MassData::maxZ || A < MassData::minA[Z] || A >= MassData::minA[Z] + MassData::nA[Z])
+				return -1;
+			int index = MassData::firstIndex[Z] + A - MassData::minA[Z];
+			return MassData::atomicMasses[index].u == 0.0 ? -1 : index;
+		}
+
+		//Nuclear mass in MeV, usable in constant expressions; 0 if the isotope is not in the table
+		static constexpr double GetNuclearMass(int Z, int A)
+		{
+			int index = GetIndex(Z, A);
+			if(index == -1)
+				return 0.0;
+			return (MassData::atomicMasses[index].u + MassData::atomicMasses[index].microU*1e-6 - Z*electron_mass)*u_to_mev;
+		}
 	
 	private:
+		double MassNotFound(int Z, int A) const;
+
 		static MassLookup* s_instance;
-		std::unordered_map<std::string, double> massTable;
-		std::unordered_map<int, std::string> elementTable;
+		std::vector<double> m_masses; //MeV, by MassData index
+		std::vector<std::string> m_symbols; //interned "<A><element>", by MassData index
 
 		//constants
 		static constexpr double u_to_mev = 931.4940954;
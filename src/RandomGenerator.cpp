@@ -2,11 +2,61 @@
 
 namespace SabreRecon {
 
-	RandomGenerator::RandomGenerator() 
+	std::atomic<uint64_t> RandomGenerator::s_seed(0);
+
+	static constexpr uint32_t s_philoxM0 = 0xD2511F53;
+	static constexpr uint32_t s_philoxM1 = 0xCD9E8D57;
+	static constexpr uint32_t s_philoxW0 = 0x9E3779B9;
+	static constexpr uint32_t s_philoxW1 = 0xBB67AE85;
+	static constexpr int s_philoxRounds = 10;
+
+	RandomGenerator::RandomGenerator() :
+		m_entry(0), m_block(0), m_buffer{0.0, 0.0}, m_bufferIndex(s_drawsPerBlock)
 	{
-		std::random_device rd;
-		rng.seed(rd());
 	}
 
 	RandomGenerator::~RandomGenerator() {}
-}
\ No newline at end of file
+
+	void RandomGenerator::SetSeed(uint64_t seed)
+	{
+		s_seed.store(seed, std::memory_order_relaxed);
+	}
+
+	uint64_t RandomGenerator::GetSeed()
+	{
+		return s_seed.load(std::memory_order_relaxed);
+	}
+
+	std::array<uint32_t, 4> RandomGenerator::Philox(uint64_t seed, uint64_t entry, uint64_t block)
+	{
+		uint32_t ctr[4] = { uint32_t(entry), uint32_t(entry >> 32), uint32_t(block), uint32_t(block >> 32) };
+		uint32_t key[2] = { uint32_t(seed), uint32_t(seed >> 32) };
+		for(int i=0; i<s_philoxRounds; i++)
+		{
+			if(i > 0)
+			{
+				key[0] += s_philoxW0;
+				key[1] += s_philoxW1;
+			}
+			uint64_t product0 = uint64_t(s_philoxM0) * ctr[0];
+			uint64_t product1 = uint64_t(s_philoxM1) * ctr[2];
+			uint32_t result[4] = { uint32_t(product1 >> 32) ^ ctr[1] ^ key[0], uint32_t(product1),
+								   uint32_t(product0 >> 32) ^ ctr[3] ^ key[1], uint32_t(product0) };
+			for(int j=0; j<4; j++)
+				ctr[j] = result[j];
+		}
+		return { ctr[0], ctr[1], ctr[2], ctr[3] };
+	}
+
+	//Draw index d of an entry is half d%2 of block d/2
+	void RandomGenerator::NextBlock()
+	{
+		std::array<uint32_t, 4> bits = Philox(GetSeed(), m_entry, m_block++);
+		for(int i=0; i<s_drawsPerBlock; i++)
+		{
+			uint64_t word = (uint64_t(bits[2*i]) << 32) | bits[2*i+1];
+			m_buffer[i] = (word >> 11) * 0x1.0p-53;
+		}
+		m_bufferIndex = 0;
+	}
+}
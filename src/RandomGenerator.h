@@ -1,9 +1,17 @@
+/*
+RandomGenerator.h
+Counter-based (Philox4x32-10) random numbers. Every draw is a pure function of (seed, entry, draw index), so the
+smearing applied to an event does not depend on which thread or process handles it, or on the order events are
+processed in. Serial, multithreaded and sharded runs with the same seed fill identical histograms.
+
+Each thread has its own instance; call SetEntry before handling a tree entry and the draws restart at index 0 for it.
+*/
 #ifndef RANDOMGENERATOR_H
 #define RANDOMGENERATOR_H
 
-#include <random>
-#include <thread>
-#include <mutex>
+#include <array>
+#include <atomic>
+#include <cstdint>
 
 namespace SabreRecon {
 
@@ -11,18 +19,48 @@ namespace SabreRecon {
 	public:
 		RandomGenerator();
 		~RandomGenerator();
-		
-		inline std::mt19937& GetGenerator() { return rng; }
+
+		//Uniform on [0, 1), 53 bits
+		inline double Uniform()
+		{
+			if(m_bufferIndex == s_drawsPerBlock)
+				NextBlock();
+			return m_buffer[m_bufferIndex++];
+		}
+
+		inline void SetEntry(uint64_t entry)
+		{
+			m_entry = entry;
+			m_block = 0;
+			m_bufferIndex = s_drawsPerBlock;
+		}
+		inline uint64_t GetEntry() const { return m_entry; }
+
+		//Shared by all threads; set before processing starts
+		static void SetSeed(uint64_t seed);
+		static uint64_t GetSeed();
+
+		//One Philox4x32-10 block, keyed by the seed, with the entry and block number as the counter
+		static std::array<uint32_t, 4> Philox(uint64_t seed, uint64_t entry, uint64_t block);
+
 		inline static RandomGenerator& GetInstance()
 		{
-			static RandomGenerator s_generator;
+			thread_local RandomGenerator s_generator;
 			return s_generator;
 		}
 
 	private:
-		std::mt19937 rng;
+		void NextBlock();
+
+		uint64_t m_entry;
+		uint64_t m_block;
+		double m_buffer[2];
+		int m_bufferIndex;
+
+		static std::atomic<uint64_t> s_seed;
+		static constexpr int s_drawsPerBlock = 2; //two 64 bit halves per 128 bit block
 	};
 
 }
 
-#endif
\ No newline at end of file
+#endif
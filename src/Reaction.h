@@ -0,0 +1,73 @@
+/*
+Reaction.h
+Nuclei and reactions. A Reaction is a type built from Nuclide types (target, projectile, ejectile and an optional
+decay particle); the residual and decay fragment are derived from them and every mass is taken from the compiled-in
+mass table at compile time, so a reaction that is unphysical or has a nucleus missing from the table does not compile.
+
+	using B10_3He_4He = Reaction<Nuclide<5,10>, Nuclide<2,3>, Nuclide<2,4>>;
+	using B10_3He_4He_p = Reaction<Nuclide<5,10>, Nuclide<2,3>, Nuclide<2,4>, Nuclide<1,1>>;
+*/
+#ifndef REACTION_H
+#define REACTION_H
+
+#include "MassLookup.h"
+#include <type_traits>
+
+namespace SabreRecon {
+
+	struct NucID
+	{
+		int Z, A;
+
+		constexpr NucID() :
+		Z(0), A(0)
+		{
+		}
+
+		constexpr NucID(int z, int a) :
+		Z(z), A(a)
+		{
+		}
+	};
+
+	template<int z, int a>
+	struct Nuclide
+	{
+		static_assert(MassLookup::GetIndex(z, a) != -1, "Nuclide is not in the mass table");
+		static constexpr NucID id = NucID(z, a);
+		static constexpr double mass = MassLookup::GetNuclearMass(z, a);
+	};
+
+	//Placeholder decay particle for reactions without a decay
+	struct NoDecay
+	{
+		static constexpr NucID id = NucID();
+		static constexpr double mass = 0.0;
+	};
+
+	template<typename Target, typename Projectile, typename Ejectile, typename Decay = NoDecay>
+	struct Reaction
+	{
+		static constexpr bool hasDecay = !std::is_same_v<Decay, NoDecay>;
+
+		static constexpr NucID target = Target::id;
+		static constexpr NucID projectile = Projectile::id;
+		static constexpr NucID ejectile = Ejectile::id;
+		static constexpr NucID decay = Decay::id;
+		static constexpr NucID residual = NucID(target.Z + projectile.Z - ejectile.Z, target.A + projectile.A - ejectile.A);
+		static constexpr NucID decayFrag = hasDecay ? NucID(residual.Z - decay.Z, residual.A - decay.A) : NucID();
+
+		static_assert(MassLookup::GetIndex(residual.Z, residual.A) != -1, "Residual nucleus is unphysical or not in the mass table");
+		static_assert(!hasDecay || MassLookup::GetIndex(decayFrag.Z, decayFrag.A) != -1, "Decay fragment is unphysical or not in the mass table");
+
+		static constexpr double massTarg = Target::mass;
+		static constexpr double massProj = Projectile::mass;
+		static constexpr double massEject = Ejectile::mass;
+		static constexpr double massDecay = Decay::mass;
+		static constexpr double massResid = MassLookup::GetNuclearMass(residual.Z, residual.A);
+		static constexpr double massDecayFrag = hasDecay ? MassLookup::GetNuclearMass(decayFrag.Z, decayFrag.A) : 0.0;
+	};
+
+}
+
+#endif
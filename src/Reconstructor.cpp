@@ -1,16 +1,19 @@
 #include "Reconstructor.h"
 #include "MassLookup.h"
 #include <iostream>
+#include <algorithm>
 
 namespace SabreRecon {
 
 	constexpr double Reconstructor::s_phiDet[5]; //C++11 weirdness with static constexpr
 
-	Reconstructor::Reconstructor()
+	Reconstructor::Reconstructor() :
+		m_precision(ReconPrecision::Exact)
 	{
 	}
 
-	Reconstructor::Reconstructor(const Target& target, double spsTheta, double spsB, const std::vector<double>& spsCal)
+	Reconstructor::Reconstructor(const Target& target, double spsTheta, double spsB, const std::vector<double>& spsCal) :
+		m_precision(ReconPrecision::Exact)
 	{
 		Init(target, spsTheta, spsB, spsCal);
 	}
@@ -21,217 +24,335 @@ namespace SabreRecon {
 	{
 		m_target = target;
 		m_focalPlane.Init({spsB, spsTheta, spsCal});
+		m_fpTables.clear();
+		m_sabreTables.clear();
 		for(int i=0; i<5; i++)
 			m_sabreArray.emplace_back(SabreDetector::Parameters(s_phiDet[i], s_tiltAngle, s_zOffset, false, i));
 
 		//Setup intermediate energy loss layers
 		m_sabreDeadLayer.SetParameters({28}, {14}, {1}, s_sabreDeadlayerThickness);
+
+		m_sabreAcceptance.Init(m_sabreArray, 0.0, M_PI, s_acceptanceStep, s_acceptanceStep);
 	}
 
+	void Reconstructor::SetPrecision(ReconPrecision precision)
+	{
+		m_precision = precision;
+		if(m_precision == ReconPrecision::Fast)
+			BuildFastTables();
+	}
+
+	//Tables are only keyed here; they are loaded when a reaction first asks for them
 	void Reconstructor::AddEnergyLossTable(const std::string& filename)
 	{
-		m_elossTables.emplace_back(filename);
+		m_elossTables.Add(filename);
 	}
 
 	void Reconstructor::AddPunchThruTable(const std::string& filename)
 	{
-		m_punchTables.emplace_back(filename);
+		m_punchTables.Add(filename);
 	}
 
-	PunchTable::ElossTable* Reconstructor::GetElossTable(const NucID& projectile, const NucID& material)
+	std::vector<TableAccuracy> Reconstructor::GetTableAccuracy() const
 	{
-		MassLookup& masses = MassLookup::GetInstance();
-		std::string projString = masses.FindSymbol(projectile.Z, projectile.A);
-		std::string matString = masses.FindSymbol(material.Z, material.A) + "1"; //temp
-
-		for(auto& table : m_elossTables)
+		std::vector<TableAccuracy> accuracy;
+		m_target.GetTableAccuracy(accuracy);
+		for(auto& table : accuracy)
+			table.name = "target " + table.name;
+		std::size_t nTarget = accuracy.size();
+		m_sabreDeadLayer.GetTableAccuracy(accuracy);
+		for(std::size_t i=nTarget; i<accuracy.size(); i++)
+			accuracy[i].name = "SABRE dead layer " + accuracy[i].name;
+		for(auto& table : m_fpTables)
+		{
+			if(table.isValid)
+				accuracy.push_back(table.accuracy);
+		}
+		for(auto& table : m_sabreTables)
 		{
-			if(table.GetProjectile() == projString && table.GetMaterial() == matString)
-				return &table;
+			if(table.isBuilt)
+				accuracy.push_back(table.accuracy);
 		}
+		return accuracy;
+	}
 
-		return nullptr;
+	PunchTable::ElossTable* Reconstructor::GetElossTable(const NucID& projectile, const NucID& material)
+	{
+		return m_elossTables.Get(projectile.Z, projectile.A, material.Z, material.A);
 	}
 
 	PunchTable::PunchTable* Reconstructor::GetPunchThruTable(const NucID& projectile, const NucID& material)
 	{
-		MassLookup& masses = MassLookup::GetInstance();
-		std::string projString = masses.FindSymbol(projectile.Z, projectile.A);
-		std::string matString = masses.FindSymbol(material.Z, material.A) + "1"; //temp
-
-		for(auto& table : m_punchTables)
-		{
-			if(table.GetProjectile() == projString && table.GetMaterial() == matString)
-				return &table;
-		}
-
-		return nullptr;
+		return m_punchTables.Get(projectile.Z, projectile.A, material.Z, material.A);
 	}
 
-	TLorentzVector Reconstructor::GetSabre4Vector(const SabrePair& pair, double mass)
+	FourVec Reconstructor::GetSabre4Vector(const SabrePair& pair, double mass) const
 	{
-		TVector3 coords;
-		TLorentzVector result;
-		double p, E, theta, phi;
-		if(pair.detID == 4)
-			coords = m_sabreArray[4].GetHitCoordinates(15-pair.local_ring, pair.local_wedge);
-		else
-			coords = m_sabreArray[pair.detID].GetHitCoordinates(pair.local_ring, pair.local_wedge);
+		Vec3 coords, direction;
+		FourVec result;
+		double p, E;
+		GetSabreHit(pair, coords);
 		p = std::sqrt(pair.ringE*(pair.ringE + 2.0*mass));
 		E = pair.ringE + mass;
-		theta = coords.Theta();
-		phi = coords.Phi();
-		result.SetPxPyPzE(p*std::sin(theta)*std::cos(phi),
-						  p*std::sin(theta)*std::sin(phi),
-						  p*std::cos(theta),
-						  E);
+		direction = coords.Unit();
+		result.SetPxPyPzE(p*direction.X(), p*direction.Y(), p*direction.Z(), E);
 		return result;
 	}
 
-	TLorentzVector Reconstructor::GetSabre4VectorEloss(const SabrePair& pair, double mass, const NucID& id)
+	FourVec Reconstructor::GetSabre4VectorEloss(const SabrePair& pair, double mass, const NucID& id) const
 	{
-		TVector3 coords, sabreNorm;
-		TLorentzVector result;
-		double incidentAngle, p, E, rxnKE, theta, phi;
+		Vec3 coords;
+		const SabreDetector::Pixel& pixel = GetSabreHit(pair, coords);
+		return GetSabre4VectorEloss(SabreEnergyModel::DeadLayer, pixel, coords.Unit(), pair.ringE, mass, id, nullptr, nullptr, m_precision);
+	}
 
-		if(pair.detID == 4)
-			coords = m_sabreArray[4].GetHitCoordinates(15-pair.local_ring, pair.local_wedge);
-		else
-			coords = m_sabreArray[pair.detID].GetHitCoordinates(pair.local_ring, pair.local_wedge);
-		sabreNorm = m_sabreArray[pair.detID].GetNormTilted();
-		incidentAngle = std::acos(sabreNorm.Dot(coords)/(sabreNorm.Mag()*coords.Mag()));
+	FourVec Reconstructor::GetSabre4VectorElossPunchThru(const SabrePair& pair, double mass, const NucID& id, PunchTable::PunchTable* table) const
+	{
+		if(table == nullptr)
+			return FourVec();
 
-		rxnKE = pair.ringE + m_sabreDeadLayer.GetReverseEnergyLossTotal(id.Z, id.A, pair.ringE, incidentAngle);
-		rxnKE += m_target.GetReverseEnergyLossFractionalDepth(id.Z, id.A, rxnKE, coords.Theta(), 0.5);
-		p = std::sqrt(rxnKE*(rxnKE + 2.0*mass));
-		E = rxnKE + mass;
-		theta = coords.Theta();
-		phi = coords.Phi();
-		result.SetPxPyPzE(p*std::sin(theta)*std::cos(phi),
-						  p*std::sin(theta)*std::sin(phi),
-						  p*std::cos(theta),
-						  E);
-		return result;
+		Vec3 coords;
+		const SabreDetector::Pixel& pixel = GetSabreHit(pair, coords);
+		return GetSabre4VectorEloss(SabreEnergyModel::Punch, pixel, coords.Unit(), pair.ringE, mass, id, table, nullptr, m_precision);
 	}
 
-	TLorentzVector Reconstructor::GetSabre4VectorElossPunchThru(const SabrePair& pair, double mass, const NucID& id)
+	FourVec Reconstructor::GetSabre4VectorElossPunchThruDegraded(const SabrePair& pair, double mass, const NucID& id, PunchTable::PunchTable* ptable,
+																		PunchTable::ElossTable* etable) const
 	{
-		TVector3 coords, sabreNorm;
-		TLorentzVector result;
-		double incidentAngle, p, E, rxnKE, theta, phi;
+		if(ptable == nullptr || etable == nullptr)
+			return FourVec();
 
-		PunchTable::PunchTable* table = GetPunchThruTable(id, {14, 28});
-		if(table == nullptr)
-			return result;
+		Vec3 coords;
+		const SabreDetector::Pixel& pixel = GetSabreHit(pair, coords);
+		return GetSabre4VectorEloss(SabreEnergyModel::PunchDegraded, pixel, coords.Unit(), pair.ringE, mass, id, ptable, etable, m_precision);
+	}
+
+	FourVec Reconstructor::GetSabre4VectorElossDegraded(const SabrePair& pair, double mass, const NucID& id, PunchTable::ElossTable* etable) const
+	{
+		if(etable == nullptr)
+			return FourVec();
+
+		Vec3 coords;
+		const SabreDetector::Pixel& pixel = GetSabreHit(pair, coords);
+		return GetSabre4VectorEloss(SabreEnergyModel::Degraded, pixel, coords.Unit(), pair.ringE, mass, id, nullptr, etable, m_precision);
+	}
+
+	/*
+		Undo the energy losses of a SABRE hit already placed on a pixel. Returns an empty 4-vector (E = 0) if the energy model
+		rejects the hit or is missing its table.
+	*/
+	FourVec Reconstructor::GetSabre4VectorEloss(SabreEnergyModel model, const SabreDetector::Pixel& pixel, const Vec3& direction, double ringE, double mass,
+												const NucID& id, PunchTable::PunchTable* ptable, PunchTable::ElossTable* etable, ReconPrecision precision) const
+	{
+		FourVec result;
+		double p, E, rxnKE = -1.0;
 
-		if(pair.detID == 4)
-			coords = m_sabreArray[4].GetHitCoordinates(15-pair.local_ring, pair.local_wedge);
-		else
-			coords = m_sabreArray[pair.detID].GetHitCoordinates(pair.local_ring, pair.local_wedge);
-		sabreNorm = m_sabreArray[pair.detID].GetNormTilted();
-		incidentAngle = std::acos(sabreNorm.Dot(coords)/(sabreNorm.Mag()*coords.Mag()));
-		if(incidentAngle > M_PI/2.0)
-			incidentAngle = M_PI - incidentAngle;
-		rxnKE = table->GetInitialKineticEnergy(incidentAngle, pair.ringE);
+		const SabreEnergyTable* table = precision == ReconPrecision::Fast ? GetSabreTable(model, id) : nullptr;
+		if(table != nullptr)
+			rxnKE = EvaluateSabreTable(*table, pixel, ringE);
+		if(rxnKE < 0.0)
+		{
+			double incidentAngle, theta;
+			GetSabreHitAngles(pixel, direction, incidentAngle, theta);
+			rxnKE = GetSabreReactionKE(model, incidentAngle, theta, ringE, id, ptable, etable);
+		}
 		if(rxnKE == 0.0)
 			return result;
-		rxnKE += m_target.GetReverseEnergyLossFractionalDepth(id.Z, id.A, rxnKE, coords.Theta(), 0.5);
+
 		p = std::sqrt(rxnKE*(rxnKE + 2.0*mass));
 		E = rxnKE + mass;
-		theta = coords.Theta();
-		phi = coords.Phi();
-		result.SetPxPyPzE(p*std::sin(theta)*std::cos(phi), p*std::sin(theta)*std::sin(phi), p*std::cos(theta), E);
+		result.SetPxPyPzE(p*direction.X(), p*direction.Y(), p*direction.Z(), E);
 		return result;
 	}
 
-	TLorentzVector Reconstructor::GetSabre4VectorElossPunchThruDegraded(const SabrePair& pair, double mass, const NucID& id)
+	//Angles of the smeared hit; an invalid channel keeps the (zero) angles of its pixel
+	void Reconstructor::GetSabreHitAngles(const SabreDetector::Pixel& pixel, const Vec3& direction, double& incidentAngle, double& theta) const
 	{
-		TVector3 coords, sabreNorm;
-		TLorentzVector result;
-		double incidentAngle, p, E, rxnKE, theta, phi;
+		incidentAngle = pixel.detID < 0 ? pixel.incidentAngle : m_sabreArray[pixel.detID].GetIncidentAngle(direction);
+		theta = direction.Theta();
+	}
 
-		PunchTable::PunchTable* ptable = GetPunchThruTable(id, {14, 28});
-		PunchTable::ElossTable* etable = GetElossTable(id, {73, 181});
-		if(ptable == nullptr || etable == nullptr)
-			return result;
+	double Reconstructor::GetSabreReactionKE(SabreEnergyModel model, double incidentAngle, double theta, double ringE, const NucID& id,
+											 PunchTable::PunchTable* ptable, PunchTable::ElossTable* etable) const
+	{
+		double rxnKE = 0.0;
+		switch(model)
+		{
+			case SabreEnergyModel::DeadLayer:
+			{
+				rxnKE = ringE + m_sabreDeadLayer.GetReverseEnergyLossTotal(id.Z, id.A, ringE, incidentAngle);
+				break;
+			}
+			case SabreEnergyModel::Punch:
+			{
+				if(ptable == nullptr)
+					return 0.0;
+				rxnKE = ptable->GetInitialKineticEnergy(incidentAngle, ringE);
+				if(rxnKE == 0.0)
+					return 0.0;
+				break;
+			}
+			case SabreEnergyModel::PunchDegraded:
+			{
+				if(ptable == nullptr || etable == nullptr)
+					return 0.0;
+				rxnKE = ptable->GetInitialKineticEnergy(incidentAngle, ringE);
+				if(rxnKE == ringE)
+					return 0.0;
+				rxnKE += etable->GetEnergyLoss(incidentAngle, rxnKE);
+				if(rxnKE == 0.0)
+					return 0.0;
+				break;
+			}
+			case SabreEnergyModel::Degraded:
+			{
+				if(etable == nullptr)
+					return 0.0;
+				rxnKE = ringE + etable->GetEnergyLoss(incidentAngle, ringE);
+				if(rxnKE == 0.0)
+					return 0.0;
+				break;
+			}
+		}
 
-		if(pair.detID == 4)
-			coords = m_sabreArray[4].GetHitCoordinates(15-pair.local_ring, pair.local_wedge);
-		else
-			coords = m_sabreArray[pair.detID].GetHitCoordinates(pair.local_ring, pair.local_wedge);
-		sabreNorm = m_sabreArray[pair.detID].GetNormTilted();
-		incidentAngle = std::acos(sabreNorm.Dot(coords)/(sabreNorm.Mag()*coords.Mag()));
-		if(incidentAngle > M_PI/2.0)
-			incidentAngle = M_PI - incidentAngle;
-
-		rxnKE = ptable->GetInitialKineticEnergy(incidentAngle, pair.ringE);
-		if(rxnKE == pair.ringE)
-			return result;
-		rxnKE += etable->GetEnergyLoss(incidentAngle, rxnKE);
-		if(rxnKE == 0.0)
-			return result;
-		rxnKE += m_target.GetReverseEnergyLossFractionalDepth(id.Z, id.A, rxnKE, coords.Theta(), 0.5);
-		p = std::sqrt(rxnKE*(rxnKE + 2.0*mass));
-		E = rxnKE + mass;
-		theta = coords.Theta();
-		phi = coords.Phi();
-		result.SetPxPyPzE(p*std::sin(theta)*std::cos(phi), p*std::sin(theta)*std::sin(phi), p*std::cos(theta), E);
-		return result;
+		return rxnKE + m_target.GetReverseEnergyLossFractionalDepth(id.Z, id.A, rxnKE, theta, 0.5);
 	}
 
-	TLorentzVector Reconstructor::GetSabre4VectorElossDegraded(const SabrePair& pair, double mass, const NucID& id)
+	const Reconstructor::SabreEnergyTable* Reconstructor::GetSabreTable(SabreEnergyModel model, const NucID& decay) const
 	{
-		TVector3 coords, sabreNorm;
-		TLorentzVector result;
-		double incidentAngle, p, E, rxnKE, theta, phi;
+		for(auto& table : m_sabreTables)
+		{
+			if(table.model == model && table.decay.Z == decay.Z && table.decay.A == decay.A)
+				return table.isBuilt ? &table : nullptr;
+		}
+		return nullptr;
+	}
 
-		PunchTable::ElossTable* etable = GetElossTable(id, {73, 181});
-		if(etable == nullptr)
-			return result;
+	//Tabulate the exact calculation at every pixel center and sample the linear interpolation halfway between the knots
+	void Reconstructor::BuildSabreTable(SabreEnergyTable& table)
+	{
+		PunchTable::PunchTable* ptable = table.ptable;
+		PunchTable::ElossTable* etable = table.etable;
+		table.isBuilt = true;
+		int nPixels = SabreDetector::GetNumberOfPixels();
+		table.rxnKE.assign(m_sabreArray.size()*nPixels*s_sabreTableKnots, 0.0f);
+		for(auto& detector : m_sabreArray)
+		{
+			for(int i=0; i<nPixels; i++)
+			{
+				const SabreDetector::Pixel& pixel = detector.GetPixel(i);
+				float* knots = table.rxnKE.data() + (pixel.detID*nPixels + pixel.index)*s_sabreTableKnots;
+				for(int k=0; k<s_sabreTableKnots; k++)
+					knots[k] = float(GetSabreReactionKE(table.model, pixel.incidentAngle, pixel.theta, s_sabreTableEMin + k*s_sabreTableEStep, table.decay, ptable, etable));
+			}
+		}
 
-		if(pair.detID == 4)
-			coords = m_sabreArray[4].GetHitCoordinates(15-pair.local_ring, pair.local_wedge);
-		else
-			coords = m_sabreArray[pair.detID].GetHitCoordinates(pair.local_ring, pair.local_wedge);
-		sabreNorm = m_sabreArray[pair.detID].GetNormTilted();
-		incidentAngle = std::acos(sabreNorm.Dot(coords)/(sabreNorm.Mag()*coords.Mag()));
-		if(incidentAngle > M_PI/2.0)
-			incidentAngle = M_PI - incidentAngle;
+		double ringE, value;
+		table.accuracy.name = "SABRE energy (Z,A)=(" + std::to_string(table.decay.Z) + "," + std::to_string(table.decay.A) + ") energy model "
+							  + std::to_string(int(table.model));
+		for(auto& detector : m_sabreArray)
+		{
+			for(int i=0; i<nPixels; i++)
+			{
+				const SabreDetector::Pixel& pixel = detector.GetPixel(i);
+				for(int k=0; k<s_sabreTableKnots-1; k++)
+				{
+					ringE = s_sabreTableEMin + (k + 0.5)*s_sabreTableEStep;
+					value = EvaluateSabreTable(table, pixel, ringE);
+					if(value < 0.0)
+						continue;
+					table.accuracy.Add(value, GetSabreReactionKE(table.model, pixel.incidentAngle, pixel.theta, ringE, table.decay, ptable, etable));
+				}
+			}
+		}
+	}
 
-		rxnKE = pair.ringE + etable->GetEnergyLoss(incidentAngle, pair.ringE);
-		if(rxnKE == 0.0)
-			return result;
-		rxnKE += m_target.GetReverseEnergyLossFractionalDepth(id.Z, id.A, rxnKE, coords.Theta(), 0.5);
-		p = std::sqrt(rxnKE*(rxnKE + 2.0*mass));
-		E = rxnKE + mass;
-		theta = coords.Theta();
-		phi = coords.Phi();
-		result.SetPxPyPzE(p*std::sin(theta)*std::cos(phi), p*std::sin(theta)*std::sin(phi), p*std::cos(theta), E);
-		return result;
+	double Reconstructor::EvaluateSabreTable(const SabreEnergyTable& table, const SabreDetector::Pixel& pixel, double ringE) const
+	{
+		double x = (ringE - s_sabreTableEMin)*(1.0/s_sabreTableEStep);
+		if(pixel.index == -1 || !(x >= 0.0 && x < s_sabreTableKnots - 1))
+			return -1.0;
+
+		int k = int(x);
+		const float* knots = table.rxnKE.data() + (pixel.detID*SabreDetector::GetNumberOfPixels() + pixel.index)*s_sabreTableKnots + k;
+		if(knots[0] == 0.0f || knots[1] == 0.0f)
+			return -1.0;
+		return knots[0] + (x - k)*(knots[1] - knots[0]);
 	}
 
-	TLorentzVector Reconstructor::GetFP4VectorEloss(double xavg, double mass, const NucID& id)
+	FourVec Reconstructor::GetFP4VectorEloss(double xavg, double mass, const NucID& id, ReconPrecision precision) const
 	{
-		TLorentzVector result;
-		double p = m_focalPlane.GetP(xavg, id.Z);
+		FourVec result;
+		const FPEjectileTable* table = precision == ReconPrecision::Fast ? GetFPTable(id) : nullptr;
 		double theta = m_focalPlane.GetFPTheta();
-		double KE = std::sqrt(p*p + mass*mass) - mass;
-		double rxnKE = KE + m_target.GetReverseEnergyLossFractionalDepth(id.Z, id.A, KE, theta, 0.5);
+		double rxnKE = table != nullptr && IsInFPTableRange(xavg) ? table->rxnKE.Evaluate(xavg) : GetFPReactionKE(xavg, mass, id);
 		double rxnP = sqrt(rxnKE*(rxnKE + 2.0*mass));
 		double rxnE = rxnKE + mass;
 		result.SetPxPyPzE(rxnP*std::sin(theta), 0.0, rxnP*std::cos(theta), rxnE);
 		return result;
 	}
 
-	TLorentzVector Reconstructor::GetProj4VectorEloss(double beamKE, double mass, const NucID& id)
+	double Reconstructor::GetFPReactionKE(double xavg, double mass, const NucID& id) const
 	{
-		TLorentzVector result;
+		double p = m_focalPlane.GetP(xavg, id.Z);
+		double KE = std::sqrt(p*p + mass*mass) - mass;
+		return KE + m_target.GetReverseEnergyLossFractionalDepth(id.Z, id.A, KE, m_focalPlane.GetFPTheta(), 0.5);
+	}
+
+	const Reconstructor::FPEjectileTable* Reconstructor::GetFPTable(const NucID& ejectile) const
+	{
+		for(auto& table : m_fpTables)
+		{
+			if(table.ejectile.Z == ejectile.Z && table.ejectile.A == ejectile.A)
+				return table.isValid ? &table : nullptr;
+		}
+		return nullptr;
+	}
+
+	/*
+		Tabulate the exact calculation on a uniform xavg grid and sample the spline halfway between the knots. If the exact
+		calculation fails anywhere on the grid the table stays invalid and every event takes the exact path.
+	*/
+	void Reconstructor::BuildFPTable(FPEjectileTable& table)
+	{
+		const NucID& ejectile = table.ejectile;
+		double mass = table.mass;
+		table.isBuilt = true;
+		int nKnots = int(std::round((s_fpTableXMax - s_fpTableXMin)/s_fpTableXStep)) + 1;
+		std::vector<double> xavg(nKnots), rxnKE(nKnots);
+		for(int i=0; i<nKnots; i++)
+		{
+			xavg[i] = s_fpTableXMin + i*s_fpTableXStep;
+			rxnKE[i] = GetFPReactionKE(xavg[i], mass, ejectile);
+			if(!std::isfinite(rxnKE[i]) || rxnKE[i] <= 0.0)
+			{
+				std::cerr<<"WARN -- Unable to build focal plane table for (Z,A)=("<<ejectile.Z<<","<<ejectile.A<<") at xavg "<<xavg[i]
+						 <<"; using the exact calculation"<<std::endl;
+				return;
+			}
+		}
+
+		table.rxnKE.ReadData(xavg, rxnKE);
+		table.isValid = true;
+
+		double x;
+		table.accuracy.name = "focal plane ejectile (Z,A)=(" + std::to_string(ejectile.Z) + "," + std::to_string(ejectile.A) + ")";
+		for(int i=0; i<nKnots-1; i++)
+		{
+			x = s_fpTableXMin + (i + 0.5)*s_fpTableXStep;
+			table.accuracy.Add(table.rxnKE.Evaluate(x), GetFPReactionKE(x, mass, ejectile));
+		}
+	}
+
+	FourVec Reconstructor::GetProj4VectorEloss(double beamKE, double mass, const NucID& id) const
+	{
+		FourVec result;
 		double rxnKE = beamKE + m_target.GetReverseEnergyLossFractionalDepth(id.Z, id.A, beamKE, 0.0, 0.5);
 		result.SetPxPyPzE(0.0,0.0,std::sqrt(rxnKE*(rxnKE+2.0*mass)),rxnKE+mass);
 		return result;
 	}
 
-	ReconResult Reconstructor::RunThreeParticleExcitation(const SabrePair& p1, const SabrePair& p2, const SabrePair& p3, const std::vector<NucID>& nuclei)
+	ReconResult Reconstructor::RunThreeParticleExcitation(const SabrePair& p1, const SabrePair& p2, const SabrePair& p3, const std::vector<NucID>& nuclei) const
 	{
 		ReconResult result;
 
@@ -267,7 +388,7 @@ namespace SabreRecon {
 		return result;
 	}
 
-	ReconResult Reconstructor::RunTwoParticleExcitation(const SabrePair& p1, const SabrePair& p2, const std::vector<NucID>& nuclei)
+	ReconResult Reconstructor::RunTwoParticleExcitation(const SabrePair& p1, const SabrePair& p2, const std::vector<NucID>& nuclei) const
 	{
 		ReconResult result;
 
@@ -301,347 +422,893 @@ namespace SabreRecon {
 		return result;
 	}
 
-	ReconResult Reconstructor::RunFPResidExcitation(double xavg, double beamKE, const std::vector<NucID>& nuclei)
+	BreakupContext Reconstructor::CreateBreakupContext(const std::vector<NucID>& particles)
 	{
-		ReconResult result;
-
-		NucID resid;
-		resid.Z = nuclei[0].Z + nuclei[1].Z - nuclei[2].Z;
-		resid.A = nuclei[0].A + nuclei[1].A - nuclei[2].A;
-
-		if(resid.Z > resid.A || resid.A <= 0 || resid.Z < 0)
+		BreakupContext breakup;
+		if(particles.size() < 2 || particles.size() > BreakupContext::s_maxParticles)
 		{
-			std::cerr<<"Invalid reisdual nucleus at Reconstructor::RunFPResidExcitation with Z: "<<resid.Z<<" A: "<<resid.A<<std::endl;
-			return result;
+			std::cerr<<"Invalid number of particles ("<<particles.size()<<") at Reconstructor::CreateBreakupContext"<<std::endl;
+			return breakup;
 		}
 
 		MassLookup& masses = MassLookup::GetInstance();
-		double massTarg = masses.FindMass(nuclei[0].Z, nuclei[0].A);
-		double massProj = masses.FindMass(nuclei[1].Z, nuclei[1].A);
-		double massEject = masses.FindMass(nuclei[2].Z, nuclei[2].A);
-		double massResid = masses.FindMass(resid.Z, resid.A);
+		breakup.nParticles = int(particles.size());
+		for(int i=0; i<breakup.nParticles; i++)
+		{
+			breakup.particles[i] = particles[i];
+			breakup.masses[i] = masses.FindMass(particles[i].Z, particles[i].A);
+			breakup.species[i] = i;
+			for(int j=0; j<i; j++)
+			{
+				if(particles[j].Z == particles[i].Z && particles[j].A == particles[i].A)
+				{
+					breakup.species[i] = breakup.species[j];
+					break;
+				}
+			}
+			breakup.parent.Z += particles[i].Z;
+			breakup.parent.A += particles[i].A;
+			if(breakup.masses[i] == 0.0)
+			{
+				std::cerr<<"Invalid particle at Reconstructor::CreateBreakupContext with Z: "<<particles[i].Z<<" A: "<<particles[i].A<<std::endl;
+				return breakup;
+			}
+		}
 
-		if(massTarg == 0.0 || massProj == 0.0 || massEject == 0.0 || massResid == 0.0)
+		breakup.massParent = masses.FindMass(breakup.parent.Z, breakup.parent.A);
+		if(breakup.massParent == 0.0)
 		{
-			std::cerr<<"Invalid nuclei at Reconstructor::RunFPResidExcitation by mass!"<<std::endl;
-			return result;
+			std::cerr<<"Invalid parent nucleus at Reconstructor::CreateBreakupContext with Z: "<<breakup.parent.Z<<" A: "<<breakup.parent.A<<std::endl;
+			return breakup;
 		}
+		breakup.isValid = true;
+		return breakup;
+	}
 
-		TLorentzVector targ_vec;
-		targ_vec.SetPxPyPzE(0.0, 0.0, 0.0, massTarg);
-		auto proj_vec = GetProj4VectorEloss(beamKE, massProj, nuclei[1]);
-		auto eject_vec = GetFP4VectorEloss(xavg, massEject, nuclei[2]);
+	//Detectors are neighbours when they are the closest possible in phi, one step of the array apart
+	uint32_t Reconstructor::GetDetectorPairMask(bool sameDetector, bool adjacentDetectors) const
+	{
+		uint32_t mask = 0;
+		double step = 360.0/m_sabreArray.size();
+		for(std::size_t a=0; a<m_sabreArray.size(); a++)
+		{
+			for(std::size_t b=0; b<m_sabreArray.size(); b++)
+			{
+				double separation = std::fabs(std::remainder(s_phiDet[a] - s_phiDet[b], 360.0));
+				bool allowed = a == b ? sameDetector : adjacentDetectors && std::fabs(separation - step) < 1.0;
+				if(allowed)
+					mask |= 1u << (5*a + b);
+			}
+		}
+		return mask;
+	}
 
-		auto resid_vec = targ_vec + proj_vec - eject_vec;
+	std::size_t Reconstructor::RunBreakup(const SabrePair* hits, std::size_t nHits, const BreakupContext& breakup, const BreakupCuts& cuts,
+										  BreakupCandidate* candidates, std::size_t maxCandidates, BreakupStatistics& stats, ReconWorkspace& workspace) const
+	{
+		if(!breakup.isValid)
+			return 0;
 
-		result.excitation = resid_vec.M() - massResid;
-		result.residThetaLab = resid_vec.Theta();
-		result.residPhiLab = resid_vec.Phi();
+		//Gather the hits over threshold; nothing is smeared yet
+		std::size_t nUsed = 0;
+		bool truncated = false;
+		for(std::size_t i=0; i<nHits; i++)
+		{
+			if(hits[i].ringE < cuts.hitEMin || hits[i].detID < 0 || hits[i].detID >= int(m_sabreArray.size()))
+				continue;
+			const SabreDetector::Pixel& pixel = GetSabrePixel(hits[i].detID, hits[i].local_ring, hits[i].local_wedge);
+			if(pixel.index == -1)
+				continue;
+			if(nUsed == s_maxBreakupHits)
+			{
+				truncated = true;
+				break;
+			}
+
+			BreakupHit& hit = workspace.m_breakupHits[nUsed++];
+			hit.pair = &hits[i];
+			hit.index = i;
+			hit.pixel = &pixel;
+			hit.center.SetXYZ(pixel.sinTheta*pixel.cosPhi, pixel.sinTheta*pixel.sinPhi, pixel.cosTheta);
+			hit.isSmeared = false;
+			std::fill(hit.hasVector, hit.hasVector + BreakupContext::s_maxParticles, false);
+		}
 
-		auto parent_vec = targ_vec + proj_vec;
-		auto boost = parent_vec.BoostVector();
-		eject_vec.Boost(-1.0*boost);
+		std::size_t n = breakup.nParticles;
+		if(nUsed < n)
+			return 0;
+		stats.nEvents++;
+		if(truncated)
+			stats.nTruncated++;
+
+		//Pair prefilters once per pair of hits
+		double cosOpeningMin = std::cos(cuts.openingMax), cosOpeningMax = std::cos(cuts.openingMin);
+		double cosOpening;
+		for(std::size_t i=0; i<nUsed; i++)
+		{
+			for(std::size_t j=i+1; j<nUsed; j++)
+			{
+				BreakupPairStatus& status = workspace.m_breakupPairs[i][j];
+				cosOpening = workspace.m_breakupHits[i].center.Dot(workspace.m_breakupHits[j].center);
+				if(!cuts.AllowsDetectors(workspace.m_breakupHits[i].pair->detID, workspace.m_breakupHits[j].pair->detID))
+					status = BreakupPairStatus::RejectedDetectors;
+				else if(cosOpening < cosOpeningMin || cosOpening > cosOpeningMax)
+					status = BreakupPairStatus::RejectedAngle;
+				else
+					status = BreakupPairStatus::Pass;
+			}
+		}
 
-		result.ejectThetaCM = eject_vec.Theta();
-		result.ejectPhiCM = eject_vec.Phi();
+		//A combination takes the worst status of its pairs, with the energy sum between the detector and angle filters
+		auto passesEnergy = [&cuts](double sumE) { return sumE >= cuts.sumEMin && sumE <= cuts.sumEMax; };
 
-		return result;
+		std::size_t nCandidates = 0;
+		std::size_t combination[BreakupContext::s_maxParticles];
+		BreakupPairStatus status;
+		double sumE;
+		for(std::size_t i=0; i<nUsed; i++)
+		{
+			for(std::size_t j=i+1; j<nUsed; j++)
+			{
+				BreakupPairStatus pairStatus = workspace.m_breakupPairs[i][j];
+				sumE = workspace.m_breakupHits[i].pair->ringE + workspace.m_breakupHits[j].pair->ringE;
+				if(n == 2)
+				{
+					stats.nCombinations++;
+					if(pairStatus == BreakupPairStatus::RejectedDetectors)
+						stats.nRejectedDetectors++;
+					else if(!passesEnergy(sumE))
+						stats.nRejectedEnergy++;
+					else if(pairStatus == BreakupPairStatus::RejectedAngle)
+						stats.nRejectedAngle++;
+					else
+					{
+						combination[0] = i;
+						combination[1] = j;
+						nCandidates = AddBreakupCandidates(combination, breakup, candidates, nCandidates, maxCandidates, stats, workspace);
+					}
+					continue;
+				}
+
+				/*
+					The detector filter comes first, so a pair on a rejected pair of detectors rejects every triple containing it
+					without looking at the third hit. A pair failing only the angle does not: the triple's energy sum is checked first.
+				*/
+				stats.nCombinations += nUsed - j - 1;
+				if(pairStatus == BreakupPairStatus::RejectedDetectors)
+				{
+					stats.nRejectedDetectors += nUsed - j - 1;
+					continue;
+				}
+				for(std::size_t k=j+1; k<nUsed; k++)
+				{
+					status = std::max({pairStatus, workspace.m_breakupPairs[i][k], workspace.m_breakupPairs[j][k]});
+					if(status == BreakupPairStatus::RejectedDetectors)
+						stats.nRejectedDetectors++;
+					else if(!passesEnergy(sumE + workspace.m_breakupHits[k].pair->ringE))
+						stats.nRejectedEnergy++;
+					else if(status == BreakupPairStatus::RejectedAngle)
+						stats.nRejectedAngle++;
+					else
+					{
+						combination[0] = i;
+						combination[1] = j;
+						combination[2] = k;
+						nCandidates = AddBreakupCandidates(combination, breakup, candidates, nCandidates, maxCandidates, stats, workspace);
+					}
+				}
+			}
+		}
+		return nCandidates;
 	}
 
-	ReconResult Reconstructor::RunSabreResidExcitationDetEject(double beamKE, const SabrePair& pair, const std::vector<NucID>& nuclei)
+	/*
+		Try every distinct assignment of the particles to the hits of a combination: the particle order is stepped through
+		the permutations of their species, which skips swaps of identical particles.
+	*/
+	std::size_t Reconstructor::AddBreakupCandidates(const std::size_t* combination, const BreakupContext& breakup, BreakupCandidate* candidates,
+													std::size_t nCandidates, std::size_t maxCandidates, BreakupStatistics& stats, ReconWorkspace& workspace) const
 	{
-		ReconResult result;
-
-		NucID resid;
-		resid.Z = nuclei[0].Z + nuclei[1].Z - nuclei[2].Z;
-		resid.A = nuclei[0].A + nuclei[1].A - nuclei[2].A;
+		//Insertion sort by species; at most three particles
+		int order[BreakupContext::s_maxParticles];
+		auto bySpecies = [&breakup](int a, int b) { return breakup.species[a] < breakup.species[b]; };
+		for(int i=0; i<breakup.nParticles; i++)
+		{
+			int j = i;
+			for(; j>0 && bySpecies(i, order[j-1]); j--)
+				order[j] = order[j-1];
+			order[j] = i;
+		}
 
-		if(resid.Z > resid.A || resid.A <= 0 || resid.Z < 0)
+		do
 		{
-			std::cerr<<"Invalid reisdual nucleus at Reconstructor::RunFPResidExcitation with Z: "<<resid.Z<<" A: "<<resid.A<<std::endl;
-			return result;
+			FourVec parent_vec;
+			double sumKE = 0.0;
+			bool valid = true;
+			for(int slot=0; slot<breakup.nParticles && valid; slot++)
+			{
+				const FourVec& vec = GetBreakupVector(workspace.m_breakupHits[combination[slot]], breakup, order[slot], stats);
+				valid = vec.E() != 0.0;
+				parent_vec = parent_vec + vec;
+				sumKE += vec.E() - breakup.masses[order[slot]];
+			}
+			if(!valid)
+				continue;
+
+			stats.nCandidates++;
+			if(nCandidates == maxCandidates)
+				continue;
+			BreakupCandidate& candidate = candidates[nCandidates++];
+			candidate = BreakupCandidate();
+			for(int slot=0; slot<breakup.nParticles; slot++)
+				candidate.hits[order[slot]] = int(workspace.m_breakupHits[combination[slot]].index);
+			candidate.result.excitation = parent_vec.M() - breakup.massParent;
+			candidate.result.sabreRxnKE = sumKE;
+			candidate.result.residThetaLab = GetTheta(parent_vec, m_precision);
+			candidate.result.residPhiLab = GetPhi(parent_vec, m_precision);
 		}
+		while(std::next_permutation(order, order + breakup.nParticles, bySpecies));
 
-		MassLookup& masses = MassLookup::GetInstance();
-		double massTarg = masses.FindMass(nuclei[0].Z, nuclei[0].A);
-		double massProj = masses.FindMass(nuclei[1].Z, nuclei[1].A);
-		double massEject = masses.FindMass(nuclei[2].Z, nuclei[2].A);
-		double massResid = masses.FindMass(resid.Z, resid.A);
+		return nCandidates;
+	}
+
+	const FourVec& Reconstructor::GetBreakupVector(BreakupHit& hit, const BreakupContext& breakup, int particle, BreakupStatistics& stats) const
+	{
+		int species = breakup.species[particle];
+		if(hit.hasVector[species])
+			return hit.vectors[species];
 
-		if(massTarg == 0.0 || massProj == 0.0 || massEject == 0.0 || massResid == 0.0)
+		if(!hit.isSmeared)
 		{
-			std::cerr<<"Invalid nuclei at Reconstructor::RunFPResidExcitation by mass!"<<std::endl;
-			return result;
+			Vec3 coords;
+			GetSabreHit(hit.pair->detID, hit.pair->local_ring, hit.pair->local_wedge, coords);
+			hit.direction = coords.Unit();
+			hit.isSmeared = true;
 		}
+		hit.vectors[species] = GetSabre4VectorEloss(SabreEnergyModel::DeadLayer, *hit.pixel, hit.direction, hit.pair->ringE, breakup.masses[particle],
+													breakup.particles[particle], nullptr, nullptr, m_precision);
+		hit.hasVector[species] = true;
+		stats.nCorrections++;
+		return hit.vectors[species];
+	}
 
-		TLorentzVector targ_vec;
-		targ_vec.SetPxPyPzE(0.0, 0.0, 0.0, massTarg);
-		auto proj_vec = GetProj4VectorEloss(beamKE, massProj, nuclei[1]);
-		auto eject_vec = GetSabre4VectorEloss(pair, massEject, nuclei[2]);
+	ReactionContext Reconstructor::CreateReactionContext(double beamKE, const std::vector<NucID>& nuclei)
+	{
+		ReactionContext rxn;
+		if(nuclei.size() < 3 || nuclei.size() > 4)
+		{
+			std::cerr<<"Invalid number of nuclei ("<<nuclei.size()<<") at Reconstructor::CreateReactionContext"<<std::endl;
+			return rxn;
+		}
 
-		auto resid_vec = targ_vec + proj_vec - eject_vec;
+		rxn.target = nuclei[0];
+		rxn.projectile = nuclei[1];
+		rxn.ejectile = nuclei[2];
+		rxn.residual.Z = rxn.target.Z + rxn.projectile.Z - rxn.ejectile.Z;
+		rxn.residual.A = rxn.target.A + rxn.projectile.A - rxn.ejectile.A;
+		if(rxn.residual.Z > rxn.residual.A || rxn.residual.A <= 0 || rxn.residual.Z < 0)
+		{
+			std::cerr<<"Invalid residual nucleus at Reconstructor::CreateReactionContext with Z: "<<rxn.residual.Z<<" A: "<<rxn.residual.A<<std::endl;
+			return rxn;
+		}
 
-		result.excitation = resid_vec.M() - massResid;
+		MassLookup& masses = MassLookup::GetInstance();
+		rxn.massTarg = masses.FindMass(rxn.target.Z, rxn.target.A);
+		rxn.massProj = masses.FindMass(rxn.projectile.Z, rxn.projectile.A);
+		rxn.massEject = masses.FindMass(rxn.ejectile.Z, rxn.ejectile.A);
+		rxn.massResid = masses.FindMass(rxn.residual.Z, rxn.residual.A);
+		if(rxn.massTarg == 0.0 || rxn.massProj == 0.0 || rxn.massEject == 0.0 || rxn.massResid == 0.0)
+		{
+			std::cerr<<"Invalid nuclei at Reconstructor::CreateReactionContext by mass!"<<std::endl;
+			return rxn;
+		}
 
-		auto parent_vec = targ_vec + proj_vec;
-		result.sabreRxnKE = eject_vec.E() - massEject;
-		auto boost = parent_vec.BoostVector();
-		eject_vec.Boost(-1.0*boost);
-		result.ejectThetaCM = eject_vec.Theta();
-		result.ejectPhiCM = eject_vec.Phi();
+		if(nuclei.size() == 4)
+		{
+			rxn.hasDecay = true;
+			rxn.decay = nuclei[3];
+			rxn.decayFrag.Z = rxn.residual.Z - rxn.decay.Z;
+			rxn.decayFrag.A = rxn.residual.A - rxn.decay.A;
+			if(rxn.decayFrag.Z > rxn.decayFrag.A || rxn.decayFrag.A <= 0 || rxn.decayFrag.Z < 0)
+			{
+				std::cerr<<"Invalid decay fragment at Reconstructor::CreateReactionContext with Z: "<<rxn.decayFrag.Z<<" A: "<<rxn.decayFrag.A<<std::endl;
+				return rxn;
+			}
+
+			rxn.massDecay = masses.FindMass(rxn.decay.Z, rxn.decay.A);
+			rxn.massDecayFrag = masses.FindMass(rxn.decayFrag.Z, rxn.decayFrag.A);
+			if(rxn.massDecay == 0.0 || rxn.massDecayFrag == 0.0)
+			{
+				std::cerr<<"Invalid decay nuclei at Reconstructor::CreateReactionContext by mass!"<<std::endl;
+				return rxn;
+			}
+		}
 
-		return result;
+		SetReactionBeam(rxn, beamKE);
+		return rxn;
 	}
 
-	ReconResult Reconstructor::RunSabreExcitation(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei)
+	void Reconstructor::SetReactionBeam(ReactionContext& rxn, double beamKE)
 	{
-		ReconResult result;
+		if(rxn.hasDecay)
+		{
+			rxn.decayPunchTable = GetPunchThruTable(rxn.decay, {14, 28});
+			rxn.decayElossTable = GetElossTable(rxn.decay, {73, 181});
+		}
 
-		NucID decayFrag;
-		decayFrag.Z = nuclei[0].Z + nuclei[1].Z - nuclei[2].Z - nuclei[3].Z;
-		decayFrag.A = nuclei[0].A + nuclei[1].A - nuclei[2].A - nuclei[3].A;
+		rxn.targ_vec.SetPxPyPzE(0.0, 0.0, 0.0, rxn.massTarg);
+		rxn.proj_vec = GetProj4VectorEloss(beamKE, rxn.massProj, rxn.projectile);
+		rxn.parent_vec = rxn.targ_vec + rxn.proj_vec;
+		rxn.parentBoost = rxn.parent_vec.BoostVector();
+		rxn.isValid = true;
+		AddFastTables(rxn);
+	}
 
-		if(decayFrag.Z > decayFrag.A || decayFrag.A <= 0 || decayFrag.Z < 0)
+	void Reconstructor::AddFastTables(const ReactionContext& rxn)
+	{
+		auto sameNucleus = [](const NucID& a, const NucID& b) { return a.Z == b.Z && a.A == b.A; };
+		auto hasFPTable = [&](const NucID& ejectile)
 		{
-			std::cerr<<"Invalid reisdual nucleus at Reconstructor::RunSabreExcitation with Z: "<<decayFrag.Z<<" A: "<<decayFrag.A<<std::endl;
-			return result;
+			return std::any_of(m_fpTables.begin(), m_fpTables.end(), [&](const FPEjectileTable& table) { return sameNucleus(table.ejectile, ejectile); });
+		};
+		if(!hasFPTable(rxn.ejectile))
+		{
+			m_fpTables.emplace_back();
+			m_fpTables.back().ejectile = rxn.ejectile;
+			m_fpTables.back().mass = rxn.massEject;
 		}
 
-		MassLookup& masses = MassLookup::GetInstance();
-		double massTarg = masses.FindMass(nuclei[0].Z, nuclei[0].A);
-		double massProj = masses.FindMass(nuclei[1].Z, nuclei[1].A);
-		double massEject = masses.FindMass(nuclei[2].Z, nuclei[2].A);
-		double massDecayBreak = masses.FindMass(nuclei[3].Z, nuclei[3].A);
-		double massDecayFrag = masses.FindMass(decayFrag.Z, decayFrag.A);
+		//One SABRE table per energy model the context has the tables for
+		auto addSabreTable = [&](SabreEnergyModel model, PunchTable::PunchTable* ptable, PunchTable::ElossTable* etable)
+		{
+			for(auto& table : m_sabreTables)
+			{
+				if(table.model == model && sameNucleus(table.decay, rxn.decay))
+					return;
+			}
+			m_sabreTables.emplace_back();
+			SabreEnergyTable& table = m_sabreTables.back();
+			table.decay = rxn.decay;
+			table.model = model;
+			table.ptable = ptable;
+			table.etable = etable;
+		};
+		if(rxn.hasDecay)
+		{
+			addSabreTable(SabreEnergyModel::DeadLayer, nullptr, nullptr);
+			if(rxn.decayPunchTable != nullptr)
+				addSabreTable(SabreEnergyModel::Punch, rxn.decayPunchTable, nullptr);
+			if(rxn.decayPunchTable != nullptr && rxn.decayElossTable != nullptr)
+				addSabreTable(SabreEnergyModel::PunchDegraded, rxn.decayPunchTable, rxn.decayElossTable);
+			if(rxn.decayElossTable != nullptr)
+				addSabreTable(SabreEnergyModel::Degraded, nullptr, rxn.decayElossTable);
+		}
+
+		if(m_precision == ReconPrecision::Fast)
+			BuildFastTables();
+	}
 
-		if(massTarg == 0.0 || massProj == 0.0 || massEject == 0.0 || massDecayBreak == 0.0 || massDecayFrag == 0.0)
+	void Reconstructor::BuildFastTables()
+	{
+		for(auto& table : m_fpTables)
 		{
-			std::cerr<<"Invalid nuclei at Reconstructor::RunSabreExcitation by mass!"<<std::endl;
-			return result;
+			if(!table.isBuilt)
+				BuildFPTable(table);
 		}
+		for(auto& table : m_sabreTables)
+		{
+			if(!table.isBuilt)
+				BuildSabreTable(table);
+		}
+	}
+
+	ReconResult Reconstructor::RunFPResidExcitation(double xavg, const ReactionContext& rxn) const
+	{
+		if(!rxn.isValid)
+			return ReconResult();
+		return GetFPResidResult(GetFP4VectorEloss(xavg, rxn.massEject, rxn.ejectile, m_precision), rxn, m_precision);
+	}
 
-		TLorentzVector targ_vec;
-		targ_vec.SetPxPyPzE(0.0, 0.0, 0.0, massTarg);
-		auto proj_vec = GetProj4VectorEloss(beamKE, massProj, nuclei[1]);
-		auto eject_vec = GetFP4VectorEloss(xavg, massEject, nuclei[2]);
-		auto decayBreak_vec = GetSabre4VectorEloss(sabre, massDecayBreak, nuclei[3]);
-		TLorentzVector resid_vec = targ_vec + proj_vec - eject_vec;
-		TLorentzVector decayFrag_vec = resid_vec - decayBreak_vec;
+	ReconResult Reconstructor::GetFPResidResult(FourVec eject_vec, const ReactionContext& rxn, ReconPrecision precision) const
+	{
+		ReconResult result;
+		auto resid_vec = rxn.parent_vec - eject_vec;
 
-		result.excitation = decayFrag_vec.M() - massDecayFrag;
-		result.sabreRxnKE = decayBreak_vec.E() - massDecayBreak;
-		auto boost = resid_vec.BoostVector();
-		decayBreak_vec.Boost(-1.0*boost);
-		result.ejectThetaCM = decayBreak_vec.Theta();
-		result.ejectPhiCM = decayBreak_vec.Phi();
+		result.excitation = resid_vec.M() - rxn.massResid;
+		result.residThetaLab = GetTheta(resid_vec, precision);
+		result.residPhiLab = GetPhi(resid_vec, precision);
+
+		eject_vec = Boost(-1.0*rxn.parentBoost)(eject_vec);
+
+		result.ejectThetaCM = GetTheta(eject_vec, precision);
+		result.ejectPhiCM = GetPhi(eject_vec, precision);
 
 		return result;
 	}
 
-	ReconResult Reconstructor::RunSabreExcitationDetEject(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei)
+	ReconResult Reconstructor::RunSabreResidExcitationDetEject(const SabrePair& pair, const ReactionContext& rxn) const
 	{
 		ReconResult result;
+		if(!rxn.isValid)
+			return result;
 
-		NucID decayFrag;
-		decayFrag.Z = nuclei[0].Z + nuclei[1].Z - nuclei[2].Z - nuclei[3].Z;
-		decayFrag.A = nuclei[0].A + nuclei[1].A - nuclei[2].A - nuclei[3].A;
+		auto eject_vec = GetSabre4VectorEloss(pair, rxn.massEject, rxn.ejectile);
 
-		if(decayFrag.Z > decayFrag.A || decayFrag.A <= 0 || decayFrag.Z < 0)
-		{
-			std::cerr<<"Invalid reisdual nucleus at Reconstructor::RunSabreExcitation with Z: "<<decayFrag.Z<<" A: "<<decayFrag.A<<std::endl;
-			return result;
-		}
+		auto resid_vec = rxn.parent_vec - eject_vec;
 
-		MassLookup& masses = MassLookup::GetInstance();
-		double massTarg = masses.FindMass(nuclei[0].Z, nuclei[0].A);
-		double massProj = masses.FindMass(nuclei[1].Z, nuclei[1].A);
-		double massEject = masses.FindMass(nuclei[2].Z, nuclei[2].A);
-		double massDecayBreak = masses.FindMass(nuclei[3].Z, nuclei[3].A);
-		double massDecayFrag = masses.FindMass(decayFrag.Z, decayFrag.A);
+		result.excitation = resid_vec.M() - rxn.massResid;
 
-		if(massTarg == 0.0 || massProj == 0.0 || massEject == 0.0 || massDecayBreak == 0.0 || massDecayFrag == 0.0)
-		{
-			std::cerr<<"Invalid nuclei at Reconstructor::RunSabreExcitation by mass!"<<std::endl;
-			return result;
-		}
+		result.sabreRxnKE = eject_vec.E() - rxn.massEject;
+		eject_vec = Boost(-1.0*rxn.parentBoost)(eject_vec);
+		result.ejectThetaCM = GetTheta(eject_vec, m_precision);
+		result.ejectPhiCM = GetPhi(eject_vec, m_precision);
 
-		TLorentzVector targ_vec;
-		targ_vec.SetPxPyPzE(0.0, 0.0, 0.0, massTarg);
-		auto proj_vec = GetProj4VectorEloss(beamKE, massProj, nuclei[1]);
-		auto decayBreak_vec = GetFP4VectorEloss(xavg, massEject, nuclei[2]);
-		auto eject_vec = GetSabre4VectorEloss(sabre, massDecayBreak, nuclei[3]);
-		TLorentzVector resid_vec = targ_vec + proj_vec - eject_vec;
-		TLorentzVector decayFrag_vec = resid_vec - decayBreak_vec;
+		return result;
+	}
 
-		result.excitation = decayFrag_vec.M() - massDecayFrag;
-		result.sabreRxnKE = eject_vec.E() - massEject;
+	ReconResult Reconstructor::RunSabreExcitation(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const
+	{
+		if(!rxn.isValid || !rxn.hasDecay)
+			return ReconResult();
+
+		auto eject_vec = GetFP4VectorEloss(xavg, rxn.massEject, rxn.ejectile, m_precision);
+		auto decayBreak_vec = GetSabre4VectorEloss(sabre, rxn.massDecay, rxn.decay);
+		return GetSabreDecayResult(eject_vec, decayBreak_vec, rxn, m_precision);
+	}
+
+	ReconResult Reconstructor::GetSabreDecayResult(const FourVec& eject_vec, FourVec decayBreak_vec, const ReactionContext& rxn, ReconPrecision precision) const
+	{
+		ReconResult result;
+		FourVec resid_vec = rxn.parent_vec - eject_vec;
+		FourVec decayFrag_vec = resid_vec - decayBreak_vec;
+
+		result.excitation = decayFrag_vec.M() - rxn.massDecayFrag;
+		result.sabreRxnKE = decayBreak_vec.E() - rxn.massDecay;
 		auto boost = resid_vec.BoostVector();
-		decayBreak_vec.Boost(-1.0*boost);
-		result.ejectThetaCM = decayBreak_vec.Theta();
-		result.ejectPhiCM = decayBreak_vec.Phi();
+		decayBreak_vec = Boost(-1.0*boost)(decayBreak_vec);
+		result.ejectThetaCM = GetTheta(decayBreak_vec, precision);
+		result.ejectPhiCM = GetPhi(decayBreak_vec, precision);
 
 		return result;
 	}
 
-	ReconResult Reconstructor::RunSabreExcitationPunch(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei)
+	ReconResult Reconstructor::RunSabreExcitationDetEject(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const
 	{
 		ReconResult result;
+		if(!rxn.isValid || !rxn.hasDecay)
+			return result;
 
-		NucID decayFrag;
-		decayFrag.Z = nuclei[0].Z + nuclei[1].Z - nuclei[2].Z - nuclei[3].Z;
-		decayFrag.A = nuclei[0].A + nuclei[1].A - nuclei[2].A - nuclei[3].A;
+		auto decayBreak_vec = GetFP4VectorEloss(xavg, rxn.massEject, rxn.ejectile, m_precision);
+		auto eject_vec = GetSabre4VectorEloss(sabre, rxn.massDecay, rxn.decay);
+		FourVec resid_vec = rxn.parent_vec - eject_vec;
+		FourVec decayFrag_vec = resid_vec - decayBreak_vec;
 
-		if(decayFrag.Z > decayFrag.A || decayFrag.A <= 0 || decayFrag.Z < 0)
-		{
-			std::cerr<<"Invalid reisdual nucleus at Reconstructor::RunSabreExcitation with Z: "<<decayFrag.Z<<" A: "<<decayFrag.A<<std::endl;
-			return result;
-		}
+		result.excitation = decayFrag_vec.M() - rxn.massDecayFrag;
+		result.sabreRxnKE = eject_vec.E() - rxn.massEject;
+		auto boost = resid_vec.BoostVector();
+		decayBreak_vec = Boost(-1.0*boost)(decayBreak_vec);
+		result.ejectThetaCM = GetTheta(decayBreak_vec, m_precision);
+		result.ejectPhiCM = GetPhi(decayBreak_vec, m_precision);
 
-		MassLookup& masses = MassLookup::GetInstance();
-		double massTarg = masses.FindMass(nuclei[0].Z, nuclei[0].A);
-		double massProj = masses.FindMass(nuclei[1].Z, nuclei[1].A);
-		double massEject = masses.FindMass(nuclei[2].Z, nuclei[2].A);
-		double massDecayBreak = masses.FindMass(nuclei[3].Z, nuclei[3].A);
-		double massDecayFrag = masses.FindMass(decayFrag.Z, decayFrag.A);
+		return result;
+	}
+
+	ReconResult Reconstructor::RunSabreExcitationPunch(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const
+	{
+		if(!rxn.isValid || !rxn.hasDecay)
+			return ReconResult();
+
+		auto eject_vec = GetFP4VectorEloss(xavg, rxn.massEject, rxn.ejectile, m_precision);
+		auto decayBreak_vec = GetSabre4VectorElossPunchThru(sabre, rxn.massDecay, rxn.decay, rxn.decayPunchTable);
+		if(decayBreak_vec.E() == 0.0)
+			return ReconResult();
+		return GetSabreDecayResult(eject_vec, decayBreak_vec, rxn, m_precision);
+	}
+
+	ReconResult Reconstructor::RunSabreExcitationPunchDegraded(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const
+	{
+		if(!rxn.isValid || !rxn.hasDecay)
+			return ReconResult();
+
+		auto eject_vec = GetFP4VectorEloss(xavg, rxn.massEject, rxn.ejectile, m_precision);
+		auto decayBreak_vec = GetSabre4VectorElossPunchThruDegraded(sabre, rxn.massDecay, rxn.decay, rxn.decayPunchTable, rxn.decayElossTable);
+		if(decayBreak_vec.E() == 0.0)
+			return ReconResult();
+		return GetSabreDecayResult(eject_vec, decayBreak_vec, rxn, m_precision);
+	}
+
+	ReconResult Reconstructor::RunSabreExcitationDegraded(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const
+	{
+		if(!rxn.isValid || !rxn.hasDecay)
+			return ReconResult();
+
+		auto eject_vec = GetFP4VectorEloss(xavg, rxn.massEject, rxn.ejectile, m_precision);
+		auto decayBreak_vec = GetSabre4VectorElossDegraded(sabre, rxn.massDecay, rxn.decay, rxn.decayElossTable);
+		if(decayBreak_vec.E() == 0.0)
+			return ReconResult();
+		return GetSabreDecayResult(eject_vec, decayBreak_vec, rxn, m_precision);
+	}
 
-		if(massTarg == 0.0 || massProj == 0.0 || massEject == 0.0 || massDecayBreak == 0.0 || massDecayFrag == 0.0)
+	Vec3 Reconstructor::RunHypotheses(double xavg, const SabrePair& sabre, const ReconHypothesis* hypotheses, ReconResult* results, std::size_t n,
+									  ReconWorkspace& workspace, ReconPrecision precision) const
+	{
+		Vec3 coords;
+		const SabreDetector::Pixel& pixel = GetSabreHit(sabre, coords);
+		Vec3 direction = coords.Unit();
+		std::vector<FourVec>& ejectVectors = workspace.m_hypothesisEject;
+		std::vector<FourVec>& decayVectors = workspace.m_hypothesisDecay;
+		if(ejectVectors.size() < n)
 		{
-			std::cerr<<"Invalid nuclei at Reconstructor::RunSabreExcitation by mass!"<<std::endl;
-			return result;
+			ejectVectors.resize(n);
+			decayVectors.resize(n);
 		}
 
-		TLorentzVector targ_vec;
-		targ_vec.SetPxPyPzE(0.0, 0.0, 0.0, massTarg);
-		auto proj_vec = GetProj4VectorEloss(beamKE, massProj, nuclei[1]);
-		auto eject_vec = GetFP4VectorEloss(xavg, massEject, nuclei[2]);
-		auto decayBreak_vec = GetSabre4VectorElossPunchThru(sabre, massDecayBreak, nuclei[3]);
-		if(decayBreak_vec.E() == 0.0)
+		auto sameNucleus = [](const NucID& a, const NucID& b) { return a.Z == b.Z && a.A == b.A; };
+		for(std::size_t i=0; i<n; i++)
 		{
-			return result;
+			const ReactionContext& rxn = *(hypotheses[i].rxn);
+			results[i] = ReconResult();
+			if(!rxn.isValid)
+				continue;
+
+			//Reuse the 4-vectors of an earlier valid hypothesis with the same ejectile / decay particle and model
+			std::size_t j = 0;
+			while(j < i && !(hypotheses[j].rxn->isValid && sameNucleus(hypotheses[j].rxn->ejectile, rxn.ejectile)))
+				j++;
+			ejectVectors[i] = j < i ? ejectVectors[j] : GetFP4VectorEloss(xavg, rxn.massEject, rxn.ejectile, precision);
+
+			if(!rxn.hasDecay)
+			{
+				results[i] = GetFPResidResult(ejectVectors[i], rxn, precision);
+				continue;
+			}
+
+			j = 0;
+			while(j < i && !(hypotheses[j].rxn->isValid && hypotheses[j].rxn->hasDecay && hypotheses[j].model == hypotheses[i].model
+							 && sameNucleus(hypotheses[j].rxn->decay, rxn.decay)))
+				j++;
+			decayVectors[i] = j < i ? decayVectors[j] : GetSabre4VectorEloss(hypotheses[i].model, pixel, direction, sabre.ringE, rxn.massDecay, rxn.decay,
+																						rxn.decayPunchTable, rxn.decayElossTable, precision);
+			if(decayVectors[i].E() == 0.0)
+				continue;
+			results[i] = GetSabreDecayResult(ejectVectors[i], decayVectors[i], rxn, precision);
 		}
-		TLorentzVector resid_vec = targ_vec + proj_vec - eject_vec;
-		TLorentzVector decayFrag_vec = resid_vec - decayBreak_vec;
+		return coords;
+	}
 
-		result.excitation = decayFrag_vec.M() - massDecayFrag;
-		result.sabreRxnKE = decayBreak_vec.E() - massDecayBreak;
-		auto boost = resid_vec.BoostVector();
-		decayBreak_vec.Boost(-1.0*boost);
-		result.ejectThetaCM = decayBreak_vec.Theta();
-		result.ejectPhiCM = decayBreak_vec.Phi();
+	void Reconstructor::SetDefaultResults(ReconColumns& results, std::size_t offset, std::size_t n) const
+	{
+		ReconResult defaults;
+		auto fill = [offset, n](double* column, double value) { if(column != nullptr) std::fill(column + offset, column + offset + n, value); };
+		fill(results.excitation, defaults.excitation);
+		fill(results.sabreRxnKE, defaults.sabreRxnKE);
+		fill(results.ejectThetaCM, defaults.ejectThetaCM);
+		fill(results.ejectPhiCM, defaults.ejectPhiCM);
+		fill(results.residThetaLab, defaults.residThetaLab);
+		fill(results.residPhiLab, defaults.residPhiLab);
+		fill(results.residThetaCM, defaults.residThetaCM);
+		fill(results.residPhiCM, defaults.residPhiCM);
+	}
 
-		return result;
+	void Reconstructor::GetFP4VectorEloss(const double* xavg, double mass, const NucID& id, BatchColumns& columns, std::size_t n) const
+	{
+		const FPEjectileTable* table = m_precision == ReconPrecision::Fast ? GetFPTable(id) : nullptr;
+		double theta = m_focalPlane.GetFPTheta();
+		double sinTheta = std::sin(theta), cosTheta = std::cos(theta);
+		double rxnKE, rxnP;
+		for(std::size_t i=0; i<n; i++)
+			columns.energy[i] = table != nullptr && IsInFPTableRange(xavg[i]) ? table->rxnKE.Evaluate(xavg[i]) : GetFPReactionKE(xavg[i], mass, id);
+		for(std::size_t i=0; i<n; i++)
+		{
+			rxnKE = columns.energy[i];
+			rxnP = std::sqrt(rxnKE*(rxnKE + 2.0*mass));
+			columns.ejectPx[i] = rxnP*sinTheta;
+			columns.ejectPz[i] = rxnP*cosTheta;
+			columns.ejectE[i] = rxnKE + mass;
+		}
 	}
 
-	ReconResult Reconstructor::RunSabreExcitationPunchDegraded(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei)
+	/*Fills the SABRE 4-vectors of the chunk; events rejected by the energy model get a null 4-vector, as in the per-event functions*/
+	void Reconstructor::GetSabre4VectorEloss(SabreEnergyModel model, const SabreColumns& sabre, std::size_t offset, double mass, const NucID& id,
+											 PunchTable::PunchTable* ptable, PunchTable::ElossTable* etable, BatchColumns& columns, std::size_t n) const
 	{
-		ReconResult result;
+		std::fill(columns.sabrePx, columns.sabrePx + n, 0.0);
+		std::fill(columns.sabrePy, columns.sabrePy + n, 0.0);
+		std::fill(columns.sabrePz, columns.sabrePz + n, 0.0);
+		std::fill(columns.sabreE, columns.sabreE + n, 0.0);
+		if((model == SabreEnergyModel::Punch && ptable == nullptr) || (model == SabreEnergyModel::PunchDegraded && (ptable == nullptr || etable == nullptr))
+			|| (model == SabreEnergyModel::Degraded && etable == nullptr))
+			return;
+
+		RandomGenerator& generator = RandomGenerator::GetInstance();
+		Vec3 coords, direction;
+		for(std::size_t i=0; i<n; i++)
+		{
+			if(sabre.entries != nullptr)
+				generator.SetEntry(sabre.entries[offset + i]);
+			const SabreDetector::Pixel& pixel = GetSabreHit(sabre.detID[offset + i], sabre.localRing[offset + i], sabre.localWedge[offset + i], coords);
+			direction = coords.Unit();
+			columns.ux[i] = direction.X();
+			columns.uy[i] = direction.Y();
+			columns.uz[i] = direction.Z();
+			GetSabreHitAngles(pixel, direction, columns.angle[i], columns.theta[i]);
+			columns.pixels[i] = &pixel;
+		}
 
-		NucID decayFrag;
-		decayFrag.Z = nuclei[0].Z + nuclei[1].Z - nuclei[2].Z - nuclei[3].Z;
-		decayFrag.A = nuclei[0].A + nuclei[1].A - nuclei[2].A - nuclei[3].A;
+		//Fast tier: the whole energy correction is one table lookup per hit
+		const double* ringE = sabre.ringE + offset;
+		const SabreEnergyTable* table = m_precision == ReconPrecision::Fast ? GetSabreTable(model, id) : nullptr;
+		if(table != nullptr)
+		{
+			double rxnKE, p;
+			for(std::size_t i=0; i<n; i++)
+			{
+				rxnKE = EvaluateSabreTable(*table, *columns.pixels[i], ringE[i]);
+				if(rxnKE < 0.0)
+					rxnKE = GetSabreReactionKE(model, columns.angle[i], columns.theta[i], ringE[i], id, ptable, etable);
+				if(rxnKE == 0.0)
+					continue;
+				p = std::sqrt(rxnKE*(rxnKE + 2.0*mass));
+				columns.sabrePx[i] = p*columns.ux[i];
+				columns.sabrePy[i] = p*columns.uy[i];
+				columns.sabrePz[i] = p*columns.uz[i];
+				columns.sabreE[i] = rxnKE + mass;
+			}
+			return;
+		}
 
-		if(decayFrag.Z > decayFrag.A || decayFrag.A <= 0 || decayFrag.Z < 0)
+		//Undo the detector side energy loss
+		switch(model)
 		{
-			std::cerr<<"Invalid reisdual nucleus at Reconstructor::RunSabreExcitation with Z: "<<decayFrag.Z<<" A: "<<decayFrag.A<<std::endl;
-			return result;
+			case SabreEnergyModel::DeadLayer:
+			{
+				m_sabreDeadLayer.GetReverseEnergyLossTotal(id.Z, id.A, ringE, columns.angle, columns.eloss, n);
+				for(std::size_t i=0; i<n; i++)
+					columns.energy[i] = ringE[i] + columns.eloss[i];
+				break;
+			}
+			case SabreEnergyModel::Punch:
+			{
+				ptable->GetInitialKineticEnergy(columns.angle, ringE, columns.energy, n);
+				break;
+			}
+			case SabreEnergyModel::PunchDegraded:
+			{
+				ptable->GetInitialKineticEnergy(columns.angle, ringE, columns.energy, n);
+				etable->GetEnergyLoss(columns.angle, columns.energy, columns.eloss, n);
+				for(std::size_t i=0; i<n; i++)
+					columns.energy[i] = columns.energy[i] == ringE[i] ? 0.0 : columns.energy[i] + columns.eloss[i];
+				break;
+			}
+			case SabreEnergyModel::Degraded:
+			{
+				etable->GetEnergyLoss(columns.angle, ringE, columns.eloss, n);
+				for(std::size_t i=0; i<n; i++)
+					columns.energy[i] = ringE[i] + columns.eloss[i];
+				break;
+			}
 		}
 
-		MassLookup& masses = MassLookup::GetInstance();
-		double massTarg = masses.FindMass(nuclei[0].Z, nuclei[0].A);
-		double massProj = masses.FindMass(nuclei[1].Z, nuclei[1].A);
-		double massEject = masses.FindMass(nuclei[2].Z, nuclei[2].A);
-		double massDecayBreak = masses.FindMass(nuclei[3].Z, nuclei[3].A);
-		double massDecayFrag = masses.FindMass(decayFrag.Z, decayFrag.A);
+		//Target energy loss only for the events that survived, gathered so the lookups stay contiguous
+		std::size_t nValid = 0;
+		for(std::size_t i=0; i<n; i++)
+		{
+			if(model != SabreEnergyModel::DeadLayer && columns.energy[i] == 0.0)
+				continue;
+			columns.index[nValid] = i;
+			columns.gathered[nValid] = columns.energy[i];
+			columns.angle[nValid] = columns.theta[i];
+			nValid++;
+		}
+		m_target.GetReverseEnergyLossFractionalDepth(id.Z, id.A, columns.gathered, columns.angle, 0.5, columns.eloss, nValid);
 
-		if(massTarg == 0.0 || massProj == 0.0 || massEject == 0.0 || massDecayBreak == 0.0 || massDecayFrag == 0.0)
+		double rxnKE, p;
+		for(std::size_t k=0; k<nValid; k++)
 		{
-			std::cerr<<"Invalid nuclei at Reconstructor::RunSabreExcitation by mass!"<<std::endl;
-			return result;
+			std::size_t i = columns.index[k];
+			rxnKE = columns.gathered[k] + columns.eloss[k];
+			p = std::sqrt(rxnKE*(rxnKE + 2.0*mass));
+			columns.sabrePx[i] = p*columns.ux[i];
+			columns.sabrePy[i] = p*columns.uy[i];
+			columns.sabrePz[i] = p*columns.uz[i];
+			columns.sabreE[i] = rxnKE + mass;
 		}
+	}
 
-		TLorentzVector targ_vec;
-		targ_vec.SetPxPyPzE(0.0, 0.0, 0.0, massTarg);
-		auto proj_vec = GetProj4VectorEloss(beamKE, massProj, nuclei[1]);
-		auto eject_vec = GetFP4VectorEloss(xavg, massEject, nuclei[2]);
-		auto decayBreak_vec = GetSabre4VectorElossPunchThruDegraded(sabre, massDecayBreak, nuclei[3]);
-		if(decayBreak_vec.E() == 0.0)
+	void Reconstructor::RunFPResidExcitation(const double* xavg, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const
+	{
+		SetDefaultResults(results, 0, n);
+		if(!rxn.isValid)
+			return;
+
+		BatchColumns columns;
+		for(std::size_t offset=0; offset<n; offset+=s_batchChunk)
 		{
-			return result;
+			std::size_t count = std::min(s_batchChunk, n - offset);
+			GetFP4VectorEloss(xavg + offset, rxn.massEject, rxn.ejectile, columns, count);
+			GetFPResidColumns(rxn, columns, count);
+
+			if(results.excitation != nullptr)
+				std::copy(columns.excitation, columns.excitation + count, results.excitation + offset);
+			if(results.residThetaLab != nullptr)
+				GetThetaColumn(columns.residPx, columns.residPy, columns.residPz, results.residThetaLab + offset, count);
+			if(results.residPhiLab != nullptr)
+				GetPhiColumn(columns.residPx, columns.residPy, results.residPhiLab + offset, count);
+			if(results.ejectThetaCM != nullptr)
+				GetThetaColumn(columns.cmPx, columns.cmPy, columns.cmPz, results.ejectThetaCM + offset, count);
+			if(results.ejectPhiCM != nullptr)
+				GetPhiColumn(columns.cmPx, columns.cmPy, results.ejectPhiCM + offset, count);
 		}
-		TLorentzVector resid_vec = targ_vec + proj_vec - eject_vec;
-		TLorentzVector decayFrag_vec = resid_vec - decayBreak_vec;
+	}
 
-		result.excitation = decayFrag_vec.M() - massDecayFrag;
-		result.sabreRxnKE = decayBreak_vec.E() - massDecayBreak;
-		auto boost = resid_vec.BoostVector();
-		decayBreak_vec.Boost(-1.0*boost);
-		result.ejectThetaCM = decayBreak_vec.Theta();
-		result.ejectPhiCM = decayBreak_vec.Phi();
+	void Reconstructor::RunSabreExcitation(const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const
+	{
+		RunSabreExcitationBatch(SabreEnergyModel::DeadLayer, xavg, sabre, rxn, results, n);
+	}
 
-		return result;
+	void Reconstructor::RunSabreExcitationPunch(const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const
+	{
+		RunSabreExcitationBatch(SabreEnergyModel::Punch, xavg, sabre, rxn, results, n);
 	}
 
-	ReconResult Reconstructor::RunSabreExcitationDegraded(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei)
+	void Reconstructor::RunSabreExcitationPunchDegraded(const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const
 	{
-		ReconResult result;
+		RunSabreExcitationBatch(SabreEnergyModel::PunchDegraded, xavg, sabre, rxn, results, n);
+	}
 
-		NucID decayFrag;
-		decayFrag.Z = nuclei[0].Z + nuclei[1].Z - nuclei[2].Z - nuclei[3].Z;
-		decayFrag.A = nuclei[0].A + nuclei[1].A - nuclei[2].A - nuclei[3].A;
+	void Reconstructor::RunSabreExcitationDegraded(const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const
+	{
+		RunSabreExcitationBatch(SabreEnergyModel::Degraded, xavg, sabre, rxn, results, n);
+	}
 
-		if(decayFrag.Z > decayFrag.A || decayFrag.A <= 0 || decayFrag.Z < 0)
+	void Reconstructor::RunSabreExcitationBatch(SabreEnergyModel model, const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn,
+												ReconColumns& results, std::size_t n) const
+	{
+		SetDefaultResults(results, 0, n);
+		if(!rxn.isValid || !rxn.hasDecay)
+			return;
+
+		BatchColumns columns;
+		std::size_t count;
+		//Events the energy model rejected keep their defaults
+		auto store = [&columns, &count](double* result, const double* values)
 		{
-			std::cerr<<"Invalid reisdual nucleus at Reconstructor::RunSabreExcitation with Z: "<<decayFrag.Z<<" A: "<<decayFrag.A<<std::endl;
-			return result;
+			for(std::size_t i=0; i<count; i++)
+				result[i] = columns.isValid[i] ? values[i] : result[i];
+		};
+		for(std::size_t offset=0; offset<n; offset+=s_batchChunk)
+		{
+			count = std::min(s_batchChunk, n - offset);
+			GetFP4VectorEloss(xavg + offset, rxn.massEject, rxn.ejectile, columns, count);
+			GetSabre4VectorEloss(model, sabre, offset, rxn.massDecay, rxn.decay, rxn.decayPunchTable, rxn.decayElossTable, columns, count);
+			GetSabreDecayColumns(rxn, columns, count);
+
+			if(results.excitation != nullptr)
+				store(results.excitation + offset, columns.excitation);
+			if(results.sabreRxnKE != nullptr)
+				store(results.sabreRxnKE + offset, columns.rxnKE);
+			if(results.ejectThetaCM != nullptr)
+			{
+				GetThetaColumn(columns.cmPx, columns.cmPy, columns.cmPz, columns.angle, count);
+				store(results.ejectThetaCM + offset, columns.angle);
+			}
+			if(results.ejectPhiCM != nullptr)
+			{
+				GetPhiColumn(columns.cmPx, columns.cmPy, columns.angle, count);
+				store(results.ejectPhiCM + offset, columns.angle);
+			}
 		}
+	}
 
-		MassLookup& masses = MassLookup::GetInstance();
-		double massTarg = masses.FindMass(nuclei[0].Z, nuclei[0].A);
-		double massProj = masses.FindMass(nuclei[1].Z, nuclei[1].A);
-		double massEject = masses.FindMass(nuclei[2].Z, nuclei[2].A);
-		double massDecayBreak = masses.FindMass(nuclei[3].Z, nuclei[3].A);
-		double massDecayFrag = masses.FindMass(decayFrag.Z, decayFrag.A);
-
-		if(massTarg == 0.0 || massProj == 0.0 || massEject == 0.0 || massDecayBreak == 0.0 || massDecayFrag == 0.0)
+	/*
+		Residual and ejectile of a chunk as GetFPResidResult: the residual's invariant mass and lab momentum, and the ejectile
+		boosted into the CM frame, written out component by component so each is one pass over the columns.
+	*/
+	void Reconstructor::GetFPResidColumns(const ReactionContext& rxn, BatchColumns& columns, std::size_t n) const
+	{
+		const FourVec& parent = rxn.parent_vec;
+		Vec3 beta = -1.0*rxn.parentBoost;
+		double bx = beta.X(), by = beta.Y(), bz = beta.Z();
+		double b2 = beta.Mag2();
+		double gamma = 1.0/std::sqrt(1.0 - b2);
+		double gamma2 = b2 > 0.0 ? (gamma - 1.0)/b2 : 0.0;
+		double residE, mm, bp;
+		for(std::size_t i=0; i<n; i++)
 		{
-			std::cerr<<"Invalid nuclei at Reconstructor::RunSabreExcitation by mass!"<<std::endl;
-			return result;
+			columns.residPx[i] = parent.Px() - columns.ejectPx[i];
+			columns.residPy[i] = parent.Py() - 0.0;
+			columns.residPz[i] = parent.Pz() - columns.ejectPz[i];
+			residE = parent.E() - columns.ejectE[i];
+			mm = residE*residE - (columns.residPx[i]*columns.residPx[i] + columns.residPy[i]*columns.residPy[i] + columns.residPz[i]*columns.residPz[i]);
+			columns.excitation[i] = (mm < 0.0 ? -std::sqrt(-mm) : std::sqrt(mm)) - rxn.massResid;
+
+			bp = bx*columns.ejectPx[i] + by*0.0 + bz*columns.ejectPz[i];
+			columns.cmPx[i] = columns.ejectPx[i] + gamma2*bp*bx + gamma*bx*columns.ejectE[i];
+			columns.cmPy[i] = 0.0 + gamma2*bp*by + gamma*by*columns.ejectE[i];
+			columns.cmPz[i] = columns.ejectPz[i] + gamma2*bp*bz + gamma*bz*columns.ejectE[i];
 		}
+	}
 
-		TLorentzVector targ_vec;
-		targ_vec.SetPxPyPzE(0.0, 0.0, 0.0, massTarg);
-		auto proj_vec = GetProj4VectorEloss(beamKE, massProj, nuclei[1]);
-		auto eject_vec = GetFP4VectorEloss(xavg, massEject, nuclei[2]);
-		auto decayBreak_vec = GetSabre4VectorElossDegraded(sabre, massDecayBreak, nuclei[3]);
-		if(decayBreak_vec.E() == 0.0)
+	/*
+		Decay of a chunk as GetSabreDecayResult: the decay fragment's invariant mass and the SABRE particle boosted into the
+		residual's rest frame. Events without a SABRE 4-vector are calculated too (from the null vector) and flagged in isValid.
+	*/
+	void Reconstructor::GetSabreDecayColumns(const ReactionContext& rxn, BatchColumns& columns, std::size_t n) const
+	{
+		const FourVec& parent = rxn.parent_vec;
+		double residPx, residPy, residPz, residE, fragPx, fragPy, fragPz, fragE, mm;
+		double bx, by, bz, b2, gamma, gamma2, bp;
+		for(std::size_t i=0; i<n; i++)
 		{
-			return result;
+			columns.isValid[i] = columns.sabreE[i] != 0.0;
+			residPx = parent.Px() - columns.ejectPx[i];
+			residPy = parent.Py() - 0.0;
+			residPz = parent.Pz() - columns.ejectPz[i];
+			residE = parent.E() - columns.ejectE[i];
+			fragPx = residPx - columns.sabrePx[i];
+			fragPy = residPy - columns.sabrePy[i];
+			fragPz = residPz - columns.sabrePz[i];
+			fragE = residE - columns.sabreE[i];
+			mm = fragE*fragE - (fragPx*fragPx + fragPy*fragPy + fragPz*fragPz);
+			columns.excitation[i] = (mm < 0.0 ? -std::sqrt(-mm) : std::sqrt(mm)) - rxn.massDecayFrag;
+			columns.rxnKE[i] = columns.sabreE[i] - rxn.massDecay;
+
+			bx = -1.0*(residPx/residE);
+			by = -1.0*(residPy/residE);
+			bz = -1.0*(residPz/residE);
+			b2 = bx*bx + by*by + bz*bz;
+			gamma = 1.0/std::sqrt(1.0 - b2);
+			gamma2 = b2 > 0.0 ? (gamma - 1.0)/b2 : 0.0;
+			bp = bx*columns.sabrePx[i] + by*columns.sabrePy[i] + bz*columns.sabrePz[i];
+			columns.cmPx[i] = columns.sabrePx[i] + gamma2*bp*bx + gamma*bx*columns.sabreE[i];
+			columns.cmPy[i] = columns.sabrePy[i] + gamma2*bp*by + gamma*by*columns.sabreE[i];
+			columns.cmPz[i] = columns.sabrePz[i] + gamma2*bp*bz + gamma*bz*columns.sabreE[i];
 		}
-		TLorentzVector resid_vec = targ_vec + proj_vec - eject_vec;
-		TLorentzVector decayFrag_vec = resid_vec - decayBreak_vec;
+	}
 
-		result.excitation = decayFrag_vec.M() - massDecayFrag;
-		result.sabreRxnKE = decayBreak_vec.E() - massDecayBreak;
-		auto boost = resid_vec.BoostVector();
-		decayBreak_vec.Boost(-1.0*boost);
-		result.ejectThetaCM = decayBreak_vec.Theta();
-		result.ejectPhiCM = decayBreak_vec.Phi();
+	void Reconstructor::GetThetaColumn(const double* x, const double* y, const double* z, double* theta, std::size_t n) const
+	{
+		for(std::size_t i=0; i<n; i++)
+			theta[i] = GetTheta(Vec3(x[i], y[i], z[i]), m_precision);
+	}
 
-		return result;
+	void Reconstructor::GetPhiColumn(const double* x, const double* y, double* phi, std::size_t n) const
+	{
+		for(std::size_t i=0; i<n; i++)
+			phi[i] = GetPhi(Vec3(x[i], y[i], 0.0), m_precision);
+	}
+
+	Vec3 Reconstructor::GetSabreCoordinates(const SabrePair& pair) const
+	{
+		Vec3 coords;
+		GetSabreHit(pair, coords);
+		return coords;
+	}
+
+	const SabreDetector::Pixel& Reconstructor::GetSabreHit(const SabrePair& pair, Vec3& coords) const
+	{
+		return GetSabreHit(pair.detID, pair.local_ring, pair.local_wedge, coords);
+	}
+
+	//Detector 4 has its rings cabled in reverse
+	const SabreDetector::Pixel& Reconstructor::GetSabreHit(int detID, int localRing, int localWedge, Vec3& coords) const
+	{
+		int ring = detID == 4 ? 15 - localRing : localRing;
+		const SabreDetector& detector = m_sabreArray[detID];
+		coords = detector.GetHitCoordinates(ring, localWedge);
+		return detector.GetPixel(ring, localWedge);
 	}
 
-	TVector3 Reconstructor::GetSabreCoordinates(const SabrePair& pair)
+	const SabreDetector::Pixel& Reconstructor::GetSabrePixel(int detID, int localRing, int localWedge) const
 	{
-		if(pair.detID == 4)
-			return m_sabreArray[4].GetHitCoordinates(15-pair.local_ring, pair.local_wedge);
-		else
-			return m_sabreArray[pair.detID].GetHitCoordinates(pair.local_ring, pair.local_wedge);
+		int ring = detID == 4 ? 15 - localRing : localRing;
+		return m_sabreArray[detID].GetPixel(ring, localWedge);
 	}
 
-	TVector3 Reconstructor::GetSabreNorm(int detID)
+	Vec3 Reconstructor::GetSabreNorm(int detID) const
 	{
 		if(detID >= m_sabreArray.size() || detID < 0)
-			return TVector3();
+			return Vec3();
 		return m_sabreArray[detID].GetNormTilted();
 	}
 }
\ No newline at end of file
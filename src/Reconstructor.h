@@ -3,12 +3,20 @@
 
 #include <string>
 #include <vector>
+#include <deque>
+#include <algorithm>
+#include <cstdint>
 #include "EnergyLoss/Target.h"
 #include "EnergyLoss/ElossTable.h"
 #include "EnergyLoss/PunchTable.h"
+#include "EnergyLoss/TableRegistry.h"
+#include "EnergyLoss/CubicSpline.h"
 #include "CalDict/DataStructs.h"
-#include "TLorentzVector.h"
+#include "Reaction.h"
+#include "Kinematics/FourVec.h"
+#include "Kinematics/FastMath.h"
 #include "Detectors/SabreDetector.h"
+#include "Detectors/SabreAcceptance.h"
 #include "Detectors/FocalPlaneDetector.h"
 
 namespace SabreRecon {
@@ -25,21 +33,216 @@ namespace SabreRecon {
 		double residPhiCM = -100.0;
 	};
 
-	struct NucID
+	/*
+		Everything about a reaction that does not change event to event: masses, the derived residual/decay fragment,
+		the beam 4-vector at mid-target and the energy loss tables for the SABRE-detected decay particle.
+		Built once by Reconstructor::CreateReactionContext, from a Reaction type or at runtime from a list of nuclei (target,
+		projectile, ejectile, (optional) decay), and passed to the per-event reconstruction functions.
+	*/
+	struct ReactionContext
 	{
-		int Z, A;
+		NucID target, projectile, ejectile, decay;
+		NucID residual, decayFrag;
+		double massTarg = 0.0, massProj = 0.0, massEject = 0.0, massDecay = 0.0;
+		double massResid = 0.0, massDecayFrag = 0.0;
+		FourVec targ_vec, proj_vec, parent_vec;
+		Vec3 parentBoost;
+		PunchTable::PunchTable* decayPunchTable = nullptr;
+		PunchTable::ElossTable* decayElossTable = nullptr;
+		bool hasDecay = false;
+		bool isValid = false;
+	};
+
+	/*
+		Columns of N events for the batch reconstruction functions. detID/localRing/localWedge/ringE are as in SabrePair.
+		If entries is given, the pixel smearing of event i starts the draws of tree entry entries[i] (see RandomGenerator),
+		otherwise the draws continue the current entry's sequence.
+	*/
+	struct SabreColumns
+	{
+		const int* detID = nullptr;
+		const int* localRing = nullptr;
+		const int* localWedge = nullptr;
+		const double* ringE = nullptr;
+		const uint64_t* entries = nullptr;
+	};
+
+	//Output columns of the batch reconstruction; any may be nullptr to skip it. Events that fail keep the ReconResult defaults.
+	struct ReconColumns
+	{
+		double* excitation = nullptr;
+		double* sabreRxnKE = nullptr;
+		double* ejectThetaCM = nullptr;
+		double* ejectPhiCM = nullptr;
+		double* residThetaLab = nullptr;
+		double* residPhiLab = nullptr;
+		double* residThetaCM = nullptr;
+		double* residPhiCM = nullptr;
+	};
+
+	//Which energy losses are undone for a SABRE hit; mirrors the RunSabreExcitation* variants
+	enum class SabreEnergyModel
+	{
+		DeadLayer, //SABRE dead layer (RunSabreExcitation)
+		Punch, //punch through (RunSabreExcitationPunch)
+		PunchDegraded, //punch through a degrader (RunSabreExcitationPunchDegraded)
+		Degraded //stopped behind a degrader (RunSabreExcitationDegraded)
+	};
+
+	/*
+		One interpretation of an event for Reconstructor::RunHypotheses: a reaction and, if it has a decay, which energy
+		losses are undone for the SABRE hit. A reaction without a decay gives the focal plane residual, as RunFPResidExcitation.
+	*/
+	struct ReconHypothesis
+	{
+		const ReactionContext* rxn = nullptr;
+		SabreEnergyModel model = SabreEnergyModel::DeadLayer;
+	};
+
+	/*
+		A breakup of a parent into two or three particles that are all detected in SABRE, e.g. 8Be -> 2a or 12C -> 3a; the
+		parent is the sum of the particles. Built once by Reconstructor::CreateBreakupContext and passed to RunBreakup.
+	*/
+	struct BreakupContext
+	{
+		static constexpr int s_maxParticles = 3;
+		NucID particles[s_maxParticles];
+		double masses[s_maxParticles] = {};
+		int species[s_maxParticles] = {}; //index of the first particle that is the same nucleus
+		int nParticles = 0;
+		NucID parent;
+		double massParent = 0.0;
+		bool isValid = false;
+	};
+
+	/*
+		Prefilters of RunBreakup, applied to every combination of hits before any energy loss work, cheapest first:
+		- every pair of hits must be on a pair of detectors allowed by detectorPairs (bit 5*detA + detB, both orders set;
+		  see Reconstructor::GetDetectorPairMask)
+		- the summed ringE must be in [sumEMin, sumEMax] (MeV)
+		- the opening angle of every pair of hits, taken between their pixel centers, must be in [openingMin, openingMax] (rad)
+		Hits below hitEMin are not combined at all.
+	*/
+	struct BreakupCuts
+	{
+		double hitEMin = 0.0;
+		double sumEMin = 0.0, sumEMax = 1.0e6;
+		double openingMin = 0.0, openingMax = M_PI;
+		uint32_t detectorPairs = 0xFFFFFFFF;
 
-		NucID() :
-		Z(0), A(0)
+		inline bool AllowsDetectors(int detA, int detB) const { return (detectorPairs >> (5*detA + detB)) & 1u; }
+	};
+
+	struct BreakupCandidate
+	{
+		int hits[BreakupContext::s_maxParticles] = {-1, -1, -1}; //indices of the hits given to RunBreakup, one per BreakupContext::particles
+		//excitation of the parent, sabreRxnKE the summed reaction energy of the particles, residTheta/PhiLab the parent direction
+		ReconResult result;
+	};
+
+	//Running combinatorial cost of RunBreakup, summed over events
+	struct BreakupStatistics
+	{
+		uint64_t nEvents = 0; //events with enough hits over threshold for one combination
+		uint64_t nTruncated = 0; //events with more hits over threshold than RunBreakup takes; the extra hits are ignored
+		uint64_t nCombinations = 0;
+		uint64_t nRejectedDetectors = 0;
+		uint64_t nRejectedEnergy = 0;
+		uint64_t nRejectedAngle = 0;
+		uint64_t nCorrections = 0; //hits smeared and energy corrected, once per hit and particle species
+		uint64_t nCandidates = 0; //including any beyond the capacity given to RunBreakup
+	};
+
+	/*
+		Precision tier of the reconstruction. Exact undoes every energy loss through the target/dead layer reverse tables and
+		the punch/eloss tables, and takes all angles from libm. Fast is meant for quick-look monitoring:
+		- the reaction energy of a SABRE decay particle is read from a float table per pixel over ringE, linear between knots
+		  s_sabreTableEStep apart, one per decay particle and energy model of the contexts. The table takes the incident and
+		  polar angles of the pixel center, where the exact tier takes them from the smeared hit (up to 3 deg apart). Hits off
+		  the grid, or next to a knot the energy model rejects, use the exact calculation
+		- the reaction energy of a focal plane ejectile is read from a cubic spline over xavg, one per ejectile of the contexts
+		  (deviation from exact < 1e-3 keV)
+		- result angles use FastAtan2 (error < 1.2e-5 rad)
+		The tables are built when the fast tier is selected, or when a context is created while it is selected.
+		Error budget for the excitation energy (10B(3He,a), 74 ug/cm^2 10B, 24 MeV beam, alpha/p/d decays over 0.2-20 MeV
+		through the SABRE dead layer): max 39 keV and RMS 1.0 keV from the exact tier. Nearly all of it comes from taking the
+		SABRE energy loss angles at the pixel center; the tables themselves contribute at most 1.3 keV (RMS 0.02 keV), and the
+		excitation does not depend on the approximated result angles. Use the Histogrammer validation mode
+		(validate_precision) to check a given setup.
+	*/
+	enum class ReconPrecision
+	{
+		Exact,
+		Fast
+	};
+
+	//Running deviation between the excitation energies of two tiers, for validating the fast tier against the exact one
+	struct PrecisionDeviation
+	{
+		std::size_t nCompared = 0; //results valid in both tiers
+		std::size_t nMismatched = 0; //results valid in only one tier
+		double maxDeviation = 0.0;
+		double sumSquares = 0.0;
+
+		inline void Add(const ReconResult& test, const ReconResult& reference)
 		{
+			ReconResult invalid;
+			bool testValid = test.excitation != invalid.excitation, referenceValid = reference.excitation != invalid.excitation;
+			if(testValid != referenceValid)
+				nMismatched++;
+			if(!testValid || !referenceValid)
+				return;
+			double deviation = std::fabs(test.excitation - reference.excitation);
+			maxDeviation = std::max(maxDeviation, deviation);
+			sumSquares += deviation*deviation;
+			nCompared++;
 		}
+		inline double GetRMS() const { return nCompared == 0 ? 0.0 : std::sqrt(sumSquares/nCompared); }
+	};
+
+	/*
+		Per-event scratch of Reconstructor::RunHypotheses and RunBreakup. Reconstructing an event does not change the
+		Reconstructor, so one Reconstructor can serve several threads as long as each passes its own workspace.
+	*/
+	class ReconWorkspace
+	{
+	public:
+		static constexpr std::size_t s_maxBreakupHits = 12;
 
-		NucID(int z, int a) :
-		Z(z), A(a)
+	private:
+		friend class Reconstructor;
+
+		//One per hit over threshold of RunBreakup
+		struct BreakupHit
 		{
-		}
+			const SabrePair* pair = nullptr;
+			std::size_t index = 0; //into the hits given to RunBreakup
+			const SabreDetector::Pixel* pixel = nullptr;
+			Vec3 center; //unit vector to the pixel center
+			Vec3 direction; //smeared, once isSmeared
+			bool isSmeared = false;
+			FourVec vectors[BreakupContext::s_maxParticles]; //by species, once hasVector
+			bool hasVector[BreakupContext::s_maxParticles] = {};
+		};
+
+		//Pair prefilter results; ordered so that the worse of two is the larger, a detector rejection coming before the angle
+		enum class BreakupPairStatus : uint8_t
+		{
+			Pass,
+			RejectedAngle,
+			RejectedDetectors
+		};
+
+		std::vector<FourVec> m_hypothesisEject, m_hypothesisDecay; //RunHypotheses, one per hypothesis
+		BreakupHit m_breakupHits[s_maxBreakupHits];
+		BreakupPairStatus m_breakupPairs[s_maxBreakupHits][s_maxBreakupHits];
 	};
 
+	/*
+		Setup (Init, adding tables, SetPrecision, SetInterpolateTableTheta, creating contexts) must finish before events are
+		reconstructed. After that every reconstruction function leaves the Reconstructor unchanged: all tables are built
+		during setup, and per-event scratch lives in the caller's ReconWorkspace.
+	*/
 	class Reconstructor
 	{
 	public:
@@ -51,44 +254,252 @@ namespace SabreRecon {
 
 		void AddEnergyLossTable(const std::string& filename);
 		void AddPunchThruTable(const std::string& filename);
+		//Smooth theta interpolation in the punch through and energy loss tables (off by default). Call before creating any contexts.
+		inline void SetInterpolateTableTheta(bool interpolate)
+		{
+			m_punchTables.SetInterpolateTheta(interpolate);
+			m_elossTables.SetInterpolateTheta(interpolate);
+		}
+
+		//Applies to every reconstruction function from the next call on. Selecting the fast tier builds its tables for the contexts created so far
+		void SetPrecision(ReconPrecision precision);
+		inline ReconPrecision GetPrecision() const { return m_precision; }
+		//Accuracy of every interpolation table built so far, for the end of run statistics
+		std::vector<TableAccuracy> GetTableAccuracy() const;
 
-		ReconResult RunThreeParticleExcitation(const SabrePair& p1, const SabrePair& p2, const SabrePair& p3, const std::vector<NucID>& nuclei);
-		ReconResult RunTwoParticleExcitation(const SabrePair& p1, const SabrePair& p2, const std::vector<NucID>& nuclei);
+		//Call after all energy loss tables have been added so that they can be resolved into the context
+		ReactionContext CreateReactionContext(double beamKE, const std::vector<NucID>& nuclei);
+		//For a compile-time Reaction the nuclei and masses are already checked; only the beam and the tables are set up here
+		template<typename Rxn>
+		ReactionContext CreateReactionContext(double beamKE)
+		{
+			ReactionContext rxn;
+			rxn.target = Rxn::target;
+			rxn.projectile = Rxn::projectile;
+			rxn.ejectile = Rxn::ejectile;
+			rxn.residual = Rxn::residual;
+			rxn.massTarg = Rxn::massTarg;
+			rxn.massProj = Rxn::massProj;
+			rxn.massEject = Rxn::massEject;
+			rxn.massResid = Rxn::massResid;
+			if constexpr(Rxn::hasDecay)
+			{
+				rxn.hasDecay = true;
+				rxn.decay = Rxn::decay;
+				rxn.decayFrag = Rxn::decayFrag;
+				rxn.massDecay = Rxn::massDecay;
+				rxn.massDecayFrag = Rxn::massDecayFrag;
+			}
+			SetReactionBeam(rxn, beamKE);
+			return rxn;
+		}
+
+		//particles: two or three nuclei whose sum is the parent
+		BreakupContext CreateBreakupContext(const std::vector<NucID>& particles);
+		//BreakupCuts::detectorPairs allowing hits on the same detector and/or on detectors next to each other in phi
+		uint32_t GetDetectorPairMask(bool sameDetector, bool adjacentDetectors) const;
+
+		/*
+			Reconstruct the parent of every combination of hits over threshold that passes the cuts, writing up to maxCandidates.
+			Distinct particles are tried in every assignment to the hits of a combination; identical ones only once. Hits
+			are smeared and energy corrected lazily, at most once per particle species, in the workspace, so the only
+			per-combination work after the prefilters is the 4-vector sum. At most s_maxBreakupHits hits are used.
+			Returns the number of candidates written.
+		*/
+		std::size_t RunBreakup(const SabrePair* hits, std::size_t nHits, const BreakupContext& breakup, const BreakupCuts& cuts,
+							   BreakupCandidate* candidates, std::size_t maxCandidates, BreakupStatistics& stats, ReconWorkspace& workspace) const;
+
+		ReconResult RunThreeParticleExcitation(const SabrePair& p1, const SabrePair& p2, const SabrePair& p3, const std::vector<NucID>& nuclei) const;
+		ReconResult RunTwoParticleExcitation(const SabrePair& p1, const SabrePair& p2, const std::vector<NucID>& nuclei) const;
 		//nuclei: target, projectile, ejectile
-		ReconResult RunFPResidExcitation(double xavg, double beamKE, const std::vector<NucID>& nuclei);
+		ReconResult RunFPResidExcitation(double xavg, const ReactionContext& rxn) const;
 		//nuclei: target, projectile, ejectile
-    	ReconResult RunSabreResidExcitationDetEject(double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei);
+    	ReconResult RunSabreResidExcitationDetEject(const SabrePair& sabre, const ReactionContext& rxn) const;
     	//nuclei: target, projectile, ejectile, decaySabre
-    	ReconResult RunSabreExcitation(double xavg, double beamKE, const SabrePair& sabre,  const std::vector<NucID>& nuclei);
+    	ReconResult RunSabreExcitation(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const;
     	//nuclei: target, projectile, ejectile, decayFP
-    	ReconResult RunSabreExcitationDetEject(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei);
+    	ReconResult RunSabreExcitationDetEject(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const;
 
-		ReconResult RunSabreExcitationPunch(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei);
-		ReconResult RunSabreExcitationPunchDegraded(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei);
-		ReconResult RunSabreExcitationDegraded(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei);
+		ReconResult RunSabreExcitationPunch(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const;
+		ReconResult RunSabreExcitationPunchDegraded(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const;
+		ReconResult RunSabreExcitationDegraded(double xavg, const SabrePair& sabre, const ReactionContext& rxn) const;
 
-		TVector3 GetSabreCoordinates(const SabrePair& pair);
-		TVector3 GetSabreNorm(int detID);
+		//Convenience overloads; these resolve a new ReactionContext on every call, so prefer the context versions in event loops
+		ReconResult RunFPResidExcitation(double xavg, double beamKE, const std::vector<NucID>& nuclei) { return RunFPResidExcitation(xavg, CreateReactionContext(beamKE, nuclei)); }
+    	ReconResult RunSabreResidExcitationDetEject(double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei) { return RunSabreResidExcitationDetEject(sabre, CreateReactionContext(beamKE, nuclei)); }
+    	ReconResult RunSabreExcitation(double xavg, double beamKE, const SabrePair& sabre,  const std::vector<NucID>& nuclei) { return RunSabreExcitation(xavg, sabre, CreateReactionContext(beamKE, nuclei)); }
+    	ReconResult RunSabreExcitationDetEject(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei) { return RunSabreExcitationDetEject(xavg, sabre, CreateReactionContext(beamKE, nuclei)); }
+		ReconResult RunSabreExcitationPunch(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei) { return RunSabreExcitationPunch(xavg, sabre, CreateReactionContext(beamKE, nuclei)); }
+		ReconResult RunSabreExcitationPunchDegraded(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei) { return RunSabreExcitationPunchDegraded(xavg, sabre, CreateReactionContext(beamKE, nuclei)); }
+		ReconResult RunSabreExcitationDegraded(double xavg, double beamKE, const SabrePair& sabre, const std::vector<NucID>& nuclei) { return RunSabreExcitationDegraded(xavg, sabre, CreateReactionContext(beamKE, nuclei)); }
+
+		/*
+			Batch versions of the above over n events, giving the same results as calling them event by event. Each stage
+			(SABRE hits, energy loss lookups, 4-vector arithmetic) runs as a loop over contiguous columns.
+		*/
+		void RunFPResidExcitation(const double* xavg, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const;
+		void RunSabreExcitation(const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const;
+		void RunSabreExcitationPunch(const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const;
+		void RunSabreExcitationPunchDegraded(const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const;
+		void RunSabreExcitationDegraded(const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn, ReconColumns& results, std::size_t n) const;
+
+		/*
+			Reconstruct one event under n hypotheses, filling results[i] for hypotheses[i]. The SABRE hit is smeared once and
+			shared by all hypotheses. The focal plane ejectile is calculated once per distinct ejectile, and the decay
+			particle once per distinct decay particle and energy model, so only the final kinematics run per hypothesis.
+			Returns the smeared SABRE hit coordinates.
+		*/
+		inline Vec3 RunHypotheses(double xavg, const SabrePair& sabre, const ReconHypothesis* hypotheses, ReconResult* results, std::size_t n,
+								  ReconWorkspace& workspace) const
+		{
+			return RunHypotheses(xavg, sabre, hypotheses, results, n, workspace, m_precision);
+		}
+		/*
+			As above in the given tier rather than the selected one, e.g. to compare the fast tier with the exact one event by
+			event. The fast tier's tables are only built once it has been selected with SetPrecision; without them it falls
+			back to the exact calculation.
+		*/
+		Vec3 RunHypotheses(double xavg, const SabrePair& sabre, const ReconHypothesis* hypotheses, ReconResult* results, std::size_t n,
+						   ReconWorkspace& workspace, ReconPrecision precision) const;
+
+		Vec3 GetSabreCoordinates(const SabrePair& pair) const;
+		Vec3 GetSabreNorm(int detID) const;
+		//Acceptance grid of the whole array, built by Init (a couple of seconds)
+		inline const SabreAcceptance& GetSabreAcceptance() const { return m_sabreAcceptance; }
     	
+		static constexpr std::size_t s_maxBreakupHits = ReconWorkspace::s_maxBreakupHits;
+
 	private:
-		TLorentzVector GetSabre4Vector(const SabrePair& pair, double mass);
-    	TLorentzVector GetSabre4VectorEloss(const SabrePair& pair, double mass, const NucID& id);
-    	TLorentzVector GetSabre4VectorElossPunchThru(const SabrePair& pair, double mass, const NucID& id);
-    	TLorentzVector GetSabre4VectorElossPunchThruDegraded(const SabrePair& pair, double mass, const NucID& id);
-		TLorentzVector GetSabre4VectorElossDegraded(const SabrePair& pair, double mass, const NucID& id);
-    	TLorentzVector GetFP4VectorEloss(double xavg, double mass, const NucID& id);
-    	TLorentzVector GetProj4VectorEloss(double beamKE, double mass, const NucID& id);
+		//Cached geometry of the pixel of a SABRE pair, without smearing
+		const SabreDetector::Pixel& GetSabrePixel(int detID, int localRing, int localWedge) const;
+		//Smeared hit coordinates of a SABRE pair, returning the cached geometry of its pixel
+		const SabreDetector::Pixel& GetSabreHit(const SabrePair& pair, Vec3& coords) const;
+		const SabreDetector::Pixel& GetSabreHit(int detID, int localRing, int localWedge, Vec3& coords) const;
+		FourVec GetSabre4Vector(const SabrePair& pair, double mass) const;
+    	FourVec GetSabre4VectorEloss(const SabrePair& pair, double mass, const NucID& id) const;
+    	FourVec GetSabre4VectorElossPunchThru(const SabrePair& pair, double mass, const NucID& id, PunchTable::PunchTable* ptable) const;
+    	FourVec GetSabre4VectorElossPunchThruDegraded(const SabrePair& pair, double mass, const NucID& id, PunchTable::PunchTable* ptable, PunchTable::ElossTable* etable) const;
+		FourVec GetSabre4VectorElossDegraded(const SabrePair& pair, double mass, const NucID& id, PunchTable::ElossTable* etable) const;
+		FourVec GetSabre4VectorEloss(SabreEnergyModel model, const SabreDetector::Pixel& pixel, const Vec3& direction, double ringE, double mass,
+									 const NucID& id, PunchTable::PunchTable* ptable, PunchTable::ElossTable* etable, ReconPrecision precision) const;
+		//Incident angle on the detector and polar angle from the target of a smeared hit, for the energy losses
+		void GetSabreHitAngles(const SabreDetector::Pixel& pixel, const Vec3& direction, double& incidentAngle, double& theta) const;
+		//Kinetic energy at the reaction point of a SABRE hit with the given energy loss angles; 0 if the energy model rejects it
+		double GetSabreReactionKE(SabreEnergyModel model, double incidentAngle, double theta, double ringE, const NucID& id,
+								  PunchTable::PunchTable* ptable, PunchTable::ElossTable* etable) const;
+    	FourVec GetFP4VectorEloss(double xavg, double mass, const NucID& id, ReconPrecision precision) const;
+    	FourVec GetProj4VectorEloss(double beamKE, double mass, const NucID& id) const;
+
+		//Final kinematics shared by the per-event functions and RunHypotheses
+		ReconResult GetFPResidResult(FourVec eject_vec, const ReactionContext& rxn, ReconPrecision precision) const;
+		ReconResult GetSabreDecayResult(const FourVec& eject_vec, FourVec decayBreak_vec, const ReactionContext& rxn, ReconPrecision precision) const;
+
+		inline double GetTheta(const Vec3& vec, ReconPrecision precision) const { return precision == ReconPrecision::Fast ? FastTheta(vec) : vec.Theta(); }
+		inline double GetPhi(const Vec3& vec, ReconPrecision precision) const { return precision == ReconPrecision::Fast ? FastPhi(vec) : vec.Phi(); }
+		inline double GetTheta(const FourVec& vec, ReconPrecision precision) const { return GetTheta(vec.Vect(), precision); }
+		inline double GetPhi(const FourVec& vec, ReconPrecision precision) const { return GetPhi(vec.Vect(), precision); }
+
+		static constexpr std::size_t s_batchChunk = 256; //events per pass through the batch stages
+
+		//Scratch columns for one chunk of a batch
+		struct BatchColumns
+		{
+			double ejectPx[s_batchChunk], ejectPz[s_batchChunk], ejectE[s_batchChunk];
+			double sabrePx[s_batchChunk], sabrePy[s_batchChunk], sabrePz[s_batchChunk], sabreE[s_batchChunk];
+			double ux[s_batchChunk], uy[s_batchChunk], uz[s_batchChunk];
+			double energy[s_batchChunk], angle[s_batchChunk], theta[s_batchChunk], eloss[s_batchChunk];
+			double gathered[s_batchChunk];
+			std::size_t index[s_batchChunk];
+			const SabreDetector::Pixel* pixels[s_batchChunk];
+			//Final kinematics: residual in the lab, the particle of the CM angles in its frame, and the result columns
+			double residPx[s_batchChunk], residPy[s_batchChunk], residPz[s_batchChunk];
+			double cmPx[s_batchChunk], cmPy[s_batchChunk], cmPz[s_batchChunk];
+			double excitation[s_batchChunk], rxnKE[s_batchChunk];
+			bool isValid[s_batchChunk];
+		};
+
+		void RunSabreExcitationBatch(SabreEnergyModel model, const double* xavg, const SabreColumns& sabre, const ReactionContext& rxn,
+									 ReconColumns& results, std::size_t n) const;
+		void GetFP4VectorEloss(const double* xavg, double mass, const NucID& id, BatchColumns& columns, std::size_t n) const;
+		void GetSabre4VectorEloss(SabreEnergyModel model, const SabreColumns& sabre, std::size_t offset, double mass, const NucID& id,
+								  PunchTable::PunchTable* ptable, PunchTable::ElossTable* etable, BatchColumns& columns, std::size_t n) const;
+		void SetDefaultResults(ReconColumns& results, std::size_t offset, std::size_t n) const;
+		//Result columns of a chunk, with the same expressions as GetFPResidResult/GetSabreDecayResult
+		void GetFPResidColumns(const ReactionContext& rxn, BatchColumns& columns, std::size_t n) const;
+		void GetSabreDecayColumns(const ReactionContext& rxn, BatchColumns& columns, std::size_t n) const;
+		void GetThetaColumn(const double* x, const double* y, const double* z, double* theta, std::size_t n) const;
+		void GetPhiColumn(const double* x, const double* y, double* phi, std::size_t n) const;
+
+		using BreakupHit = ReconWorkspace::BreakupHit;
+		using BreakupPairStatus = ReconWorkspace::BreakupPairStatus;
+
+		const FourVec& GetBreakupVector(BreakupHit& hit, const BreakupContext& breakup, int particle, BreakupStatistics& stats) const;
+		std::size_t AddBreakupCandidates(const std::size_t* combination, const BreakupContext& breakup, BreakupCandidate* candidates,
+										 std::size_t nCandidates, std::size_t maxCandidates, BreakupStatistics& stats, ReconWorkspace& workspace) const;
+
+		//Energy loss tables, beam and parent 4-vectors of a context whose nuclei are set; marks it valid
+		void SetReactionBeam(ReactionContext& rxn, double beamKE);
+		//Register the fast tier tables of a context's particles, building them if the fast tier is selected
+		void AddFastTables(const ReactionContext& rxn);
+		void BuildFastTables();
+
+		/*
+			Fast tier kinetic energy at the reaction point of a focal plane ejectile, as a spline over xavg. It depends only on
+			xavg for a given field, calibration and target, so there is one per ejectile of the contexts. Outside of the grid
+			the exact calculation (GetFPReactionKE) is used.
+		*/
+		struct FPEjectileTable
+		{
+			NucID ejectile;
+			double mass = 0.0;
+			PunchTable::CubicSpline rxnKE;
+			bool isBuilt = false; //a failed build is kept too, so that it is only attempted once
+			bool isValid = false;
+			TableAccuracy accuracy;
+		};
+
+		double GetFPReactionKE(double xavg, double mass, const NucID& id) const;
+		//nullptr if the ejectile's table is not built or could not be built
+		const FPEjectileTable* GetFPTable(const NucID& ejectile) const;
+		void BuildFPTable(FPEjectileTable& table);
+		inline bool IsInFPTableRange(double xavg) const { return xavg >= s_fpTableXMin && xavg < s_fpTableXMax; }
+
+		/*
+			Fast tier reaction energy of a SABRE decay particle under one energy model: rxnKE[pixel*s_sabreTableKnots + knot],
+			pixel = detID*SabreDetector::GetNumberOfPixels() + index, over the ringE grid starting at s_sabreTableEMin.
+			Rejected knots hold 0.
+		*/
+		struct SabreEnergyTable
+		{
+			NucID decay;
+			SabreEnergyModel model;
+			PunchTable::PunchTable* ptable = nullptr;
+			PunchTable::ElossTable* etable = nullptr;
+			std::vector<float> rxnKE;
+			bool isBuilt = false;
+			TableAccuracy accuracy;
+		};
+
+		//nullptr if the table is not built
+		const SabreEnergyTable* GetSabreTable(SabreEnergyModel model, const NucID& decay) const;
+		void BuildSabreTable(SabreEnergyTable& table);
+		//Interpolated reaction energy, or -1 if the hit needs the exact calculation
+		double EvaluateSabreTable(const SabreEnergyTable& table, const SabreDetector::Pixel& pixel, double ringE) const;
 
 		PunchTable::PunchTable* GetPunchThruTable(const NucID& projectile, const NucID& material);
 		PunchTable::ElossTable* GetElossTable(const NucID& projectile, const NucID& material);
 
     	std::vector<SabreDetector> m_sabreArray;
+		SabreAcceptance m_sabreAcceptance;
+		std::deque<FPEjectileTable> m_fpTables; //deque so table addresses stay fixed as ejectiles are added
+		std::deque<SabreEnergyTable> m_sabreTables;
+		ReconPrecision m_precision;
     	FocalPlaneDetector m_focalPlane;
     	Target m_target;
 		Target m_sabreDeadLayer;
 
-		std::vector<PunchTable::PunchTable> m_punchTables;
-		std::vector<PunchTable::ElossTable> m_elossTables;
+		TableRegistry<PunchTable::PunchTable, PunchTable::TableType::Punch> m_punchTables;
+		TableRegistry<PunchTable::ElossTable, PunchTable::TableType::Eloss> m_elossTables;
 
     	//SABRE constants
     	static constexpr double s_phiDet[5] = { 306.0, 18.0, 234.0, 162.0, 90.0 };
@@ -97,6 +508,13 @@ namespace SabreRecon {
     	static constexpr double s_zOffset = -0.1245; //Erin's SABRE code
     	//static constexpr double s_zOffset = -0.1142; //From Ken's diagram
 		//static constexpr double s_zOffset = -0.1367; //Ken's diagram plus extra shift for our geometry
+		static constexpr double s_fpTableXMin = -300.0; //xavg grid of the focal plane tables (mm), the full focal plane
+		static constexpr double s_fpTableXMax = 300.0;
+		static constexpr double s_fpTableXStep = 0.5;
+		static constexpr double s_sabreTableEMin = 0.1; //ringE grid of the fast tier SABRE tables (MeV)
+		static constexpr double s_sabreTableEStep = 0.05;
+		static constexpr int s_sabreTableKnots = 400;
+		static constexpr double s_acceptanceStep = 0.2*M_PI/180.0; //theta and phi bin width of the acceptance grid
 		static constexpr double s_sabreDeadlayerThickness = 50.0 * 1.0e-7 * 2.3296 * 1.0e6; // 50 nm deadlayer -> ug/cm^2
 
     	//Kinematics constants
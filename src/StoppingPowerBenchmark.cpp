@@ -0,0 +1,249 @@
+#include "EnergyLoss/EnergyLoss.h"
+#include "EnergyLoss/EnergyLossConstants.h"
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <string>
+#include <cstring>
+#include <cmath>
+#include <exception>
+
+/*
+	Times EnergyLoss::GetTotalStoppingPower, which reads the per-target constants from EnergyLoss::Coefficients, against
+	the path it replaced: per-element values collected in a std::vector and every constant looked up by Z on each call.
+	Both run over the same projectiles, targets and log spaced energies (covering the low, medium and high energy
+	hydrogen stopping regions), and every value is compared bit for bit, as the Coefficients path keeps the arithmetic
+	order of the old one.
+	Usage: StoppingPowerBenchmark [number of energies per projectile and target]
+*/
+
+//The std::vector path as it was; calls are qualified so that lookup does not also find the EnergyLoss versions
+namespace OldPath {
+
+	using namespace SabreRecon::EnergyLoss;
+
+	static double Hydrogen_dEdx_Low(double ePerU, int z)
+	{
+		return std::sqrt(ePerU)*hydrogenCoefficients[z][0];
+	}
+
+	static double Hydrogen_dEdx_Med(double ePerU, int z)
+	{
+		double x = hydrogenCoefficients[z][1]*std::pow(ePerU, 0.45);
+		double y = hydrogenCoefficients[z][2]/ePerU * std::log(1.0+hydrogenCoefficients[z][3]/ePerU+hydrogenCoefficients[z][4]*ePerU);
+		return x*y/(x+y);
+	}
+
+	static double Hydrogen_dEdx_High(double ePerU, double massP, double energy, int z)
+	{
+		energy /= 1000.0; //back to MeV for ease of beta calc
+		double beta_sq = energy * (energy+2.0*massP/mev2u)/std::pow(energy+massP/mev2u, 2.0);
+		double alpha = hydrogenCoefficients[z][5]/beta_sq;
+		double epsilon = hydrogenCoefficients[z][6]*beta_sq/(1.0-beta_sq) - beta_sq - hydrogenCoefficients[z][7];
+		for(int i=1; i<5; i++)
+			epsilon += hydrogenCoefficients[z][7+i]*std::pow(std::log(ePerU), i);
+
+		return alpha * std::log(epsilon);
+	}
+
+	static double GetElectronicStoppingPower(const Parameters& params, double current_energy)
+	{
+		//Wants in units of keV
+		current_energy *= 1000.0;
+		double ePerU = current_energy/params.massP;
+		std::vector<double> values;
+		if(ePerU > maxHEperU)
+		{
+			return 0.0;
+		}
+		else if (ePerU > 1000.0)
+		{
+			for(auto& z: params.ZT)
+				values.push_back(Hydrogen_dEdx_High(ePerU, params.massP, current_energy, z));
+		}
+		else if (ePerU > 10.0)
+		{
+			for(auto& z: params.ZT)
+				values.push_back(Hydrogen_dEdx_Med(ePerU, z));
+		}
+		else if (ePerU > 0.0)
+		{
+			for(auto& z: params.ZT)
+				values.push_back(Hydrogen_dEdx_Low(ePerU, z));
+		}
+		else
+		{
+			return 0.0;
+		}
+
+		if(values.size() == 0)
+			return 0.0; //bad
+
+		if(params.ZP > 1)
+		{ //not hydrogen, need to account for effective charge
+			for(unsigned int i=0; i<values.size(); i++)
+				values[i] *= CalculateEffectiveChargeRatio(ePerU, params.ZP, params.ZT[i]);
+		}
+
+		double stopping_total = 0;
+		double conversion_factor = 0;
+		for(size_t i=0; i< params.ZT.size(); i++)
+		{
+			conversion_factor += params.composition[i]*naturalMassList[params.ZT[i]];
+			stopping_total += values[i]*params.composition[i];
+		}
+		stopping_total *= avogadro/conversion_factor;
+
+		return stopping_total;
+	}
+
+	static double GetNuclearStoppingPower(const Parameters& params, double energy)
+	{
+		energy *= 1000.0;
+		double stopping_total = 0.0;
+		double sn, x, epsilon, conversion_factor, massT;
+		for(size_t i=0; i<params.ZT.size(); i++)
+		{
+			massT = naturalMassList[params.ZT[i]];
+			x = (params.massP + massT) * std::sqrt(std::pow(params.ZP, 2.0/3.0) + std::pow(params.ZT[i], 2.0/3.0));
+			epsilon = 32.53*massT*energy/(params.ZP*params.ZT[i]*x);
+			sn = 8.462*(0.5*std::log(1.0+epsilon)/(epsilon+0.10718*std::pow(epsilon, 0.37544)))*params.ZP*params.ZT[i]*params.massP/x;
+			conversion_factor = avogadro/massT;
+			stopping_total += sn*conversion_factor*params.composition[i];
+		}
+
+		return stopping_total;
+	}
+
+	static double GetTotalStoppingPower(const Parameters& params, double current_energy)
+	{
+		if(params.ZP == 0)
+			return OldPath::GetNuclearStoppingPower(params, current_energy);
+
+		return OldPath::GetElectronicStoppingPower(params, current_energy)+OldPath::GetNuclearStoppingPower(params, current_energy);
+	}
+}
+
+struct BenchmarkCase
+{
+	SabreRecon::EnergyLoss::Parameters params;
+	std::vector<double> energies;
+};
+
+static void RunCoefficients(const std::vector<BenchmarkCase>& cases, std::vector<double>& results)
+{
+	std::size_t index = 0;
+	for(auto& benchCase : cases)
+	{
+		for(double energy : benchCase.energies)
+			results[index++] = SabreRecon::EnergyLoss::GetTotalStoppingPower(benchCase.params, energy);
+	}
+}
+
+static void RunVector(const std::vector<BenchmarkCase>& cases, std::vector<double>& results)
+{
+	std::size_t index = 0;
+	for(auto& benchCase : cases)
+	{
+		for(double energy : benchCase.energies)
+			results[index++] = OldPath::GetTotalStoppingPower(benchCase.params, energy);
+	}
+}
+
+//Best of several repetitions, in ns per stopping power
+template<typename Func>
+static double TimePath(Func&& func, const std::vector<BenchmarkCase>& cases, std::vector<double>& results)
+{
+	static constexpr int s_nRepetitions = 5;
+	double best = 0.0;
+	for(int rep=0; rep<s_nRepetitions; rep++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		func(cases, results);
+		auto stop = std::chrono::steady_clock::now();
+		double time = std::chrono::duration<double, std::nano>(stop - start).count()/results.size();
+		if(rep == 0 || time < best)
+			best = time;
+	}
+	return best;
+}
+
+int main(int argc, const char** argv)
+{
+	if(argc > 2)
+	{
+		std::cerr<<"Usage: StoppingPowerBenchmark [number of energies per projectile and target]"<<std::endl;
+		return 1;
+	}
+
+	std::size_t nEnergies = 20000;
+	if(argc == 2)
+	{
+		try
+		{
+			nEnergies = std::stoul(argv[1]);
+		}
+		catch(const std::exception&)
+		{
+			nEnergies = 0;
+		}
+		if(nEnergies < 2)
+		{
+			std::cerr<<"ERR -- Invalid number of energies "<<argv[1]<<std::endl;
+			return 1;
+		}
+	}
+
+	//Projectiles (Z, mass in u) covering each effective charge branch, on the targets/layers of the reconstruction
+	static constexpr int s_nProjectiles = 5;
+	static constexpr int s_projectileZ[s_nProjectiles] = { 1, 1, 2, 3, 6 };
+	static constexpr double s_projectileMass[s_nProjectiles] = { 1.007276, 2.013553, 4.001506, 7.014358, 11.996709 };
+	const std::vector<std::vector<int>> targetZ = { {5}, {14}, {73}, {6, 1}, {5, 8, 6} };
+	const std::vector<std::vector<double>> targetComposition = { {1}, {1}, {1}, {1, 2}, {1, 2, 1} };
+	static constexpr double s_energyMin = 1.0e-3, s_energyMax = 2.0e3; //MeV
+
+	std::vector<BenchmarkCase> cases;
+	std::size_t nValues = 0;
+	for(int p=0; p<s_nProjectiles; p++)
+	{
+		for(std::size_t t=0; t<targetZ.size(); t++)
+		{
+			BenchmarkCase benchCase;
+			benchCase.params.ZP = s_projectileZ[p];
+			benchCase.params.massP = s_projectileMass[p];
+			benchCase.params.ZT = targetZ[t];
+			benchCase.params.composition = targetComposition[t];
+			benchCase.params.energy = 0.0;
+			benchCase.params.thickness = 0.0;
+			if(!SabreRecon::EnergyLoss::InitCoefficients(benchCase.params))
+			{
+				std::cerr<<"ERR -- Unable to set up the stopping power coefficients of target "<<t<<std::endl;
+				return 1;
+			}
+			double logStep = std::log(s_energyMax/s_energyMin)/(nEnergies - 1);
+			for(std::size_t i=0; i<nEnergies; i++)
+				benchCase.energies.push_back(s_energyMin*std::exp(i*logStep));
+			nValues += nEnergies;
+			cases.push_back(benchCase);
+		}
+	}
+
+	std::vector<double> coeffResults(nValues), vectorResults(nValues);
+	double coeffTime = TimePath(RunCoefficients, cases, coeffResults);
+	double vectorTime = TimePath(RunVector, cases, vectorResults);
+
+	std::size_t nMismatched = 0;
+	for(std::size_t i=0; i<nValues; i++)
+	{
+		if(std::memcmp(&coeffResults[i], &vectorResults[i], sizeof(double)) != 0)
+			nMismatched++;
+	}
+
+	std::cout<<"Stopping powers: "<<nValues<<std::endl;
+	std::cout<<"Coefficients: "<<coeffTime<<" ns/call"<<std::endl;
+	std::cout<<"std::vector: "<<vectorTime<<" ns/call"<<std::endl;
+	std::cout<<"Speedup: "<<vectorTime/coeffTime<<std::endl;
+	std::cout<<"Values not bit-identical: "<<nMismatched<<std::endl;
+
+	return nMismatched == 0 ? 0 : 1;
+}